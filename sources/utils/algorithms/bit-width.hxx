@@ -0,0 +1,34 @@
+#ifndef UTILS_ALGORITHMS_BITWIDTH_HXX
+#define UTILS_ALGORITHMS_BITWIDTH_HXX
+
+
+#include <cstdint>  // std::uint8_t
+
+#include <type_traits>  // std::{is_integral_v, make_unsigned_t}
+
+#include "clz.hxx"  // clz
+
+
+namespace Utils
+{
+  /**
+   * @brief Number of bits needed to represent  `x',  i. e.  1 + index of the highest set bit,  or  0  for zero.
+   * @tparam TIntegral
+   * @param x
+   * @return
+   */
+  template <typename TIntegral>
+  [[nodiscard]] constexpr std::uint8_t
+  bitWidth (TIntegral x) noexcept
+  {
+    static_assert (std::is_integral_v <TIntegral>);
+
+    using unsigned_type = std::make_unsigned_t <TIntegral>;
+
+
+    return std::uint8_t (8 * sizeof (unsigned_type) - clz (unsigned_type (x)));
+  }
+}
+
+
+#endif  // UTILS_ALGORITHMS_BITWIDTH_HXX
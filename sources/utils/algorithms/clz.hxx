@@ -0,0 +1,65 @@
+#ifndef UTILS_ALGORITHMS_CLZ_HXX
+#define UTILS_ALGORITHMS_CLZ_HXX
+
+
+#include <cstdint>  // std::{uint8_t, uint64_t}
+
+#include <type_traits>  // std::{is_integral_v, make_unsigned_t}
+
+#include "popcount.hxx"  // PopcountInternals_::popcountSwar_
+
+
+namespace Utils
+{
+  /**
+   * @brief Counts leading zero bits;  returns the width of the type for zero.
+   * Compiles to  `lzcnt'/`bsr'  at run time,  in constant expressions smears the highest set bit to the right  &
+   *   counts the ones.
+   * @tparam TIntegral
+   * @param x
+   * @return
+   */
+  template <typename TIntegral>
+  [[nodiscard]] constexpr std::uint8_t
+  clz (TIntegral x) noexcept
+  {
+    static_assert (std::is_integral_v <TIntegral>);
+
+    using unsigned_type = std::make_unsigned_t <TIntegral>;
+
+
+    constexpr std::uint8_t width (8 * sizeof (unsigned_type));
+
+    const unsigned_type bits ((unsigned_type (x)));
+
+#ifdef __GNUC__
+    if (! __builtin_is_constant_evaluated ())
+    {
+      if (bits == 0)
+      {
+        return width;
+      }
+
+      if constexpr (sizeof (unsigned_type) <= sizeof (unsigned int))
+      {
+        return std::uint8_t (unsigned (__builtin_clz (bits)) - (8 * sizeof (unsigned int) - width));
+      }
+      else
+      {
+        return std::uint8_t (__builtin_clzll (bits));
+      }
+    }
+#endif  // __GNUC__
+
+    std::uint64_t smeared (bits);
+    for (unsigned shift (1); shift < width; shift *= 2)
+    {
+      smeared |= smeared >> shift;
+    }
+
+    return std::uint8_t (width - PopcountInternals_::popcountSwar_ (smeared));
+  }
+}
+
+
+#endif  // UTILS_ALGORITHMS_CLZ_HXX
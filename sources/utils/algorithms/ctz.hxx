@@ -161,11 +161,38 @@ namespace Utils
        */
       static constexpr auto shift { 58 };
     };
+
+
+    /**
+     * @brief Portable  `ctz':  isolates the lowest set bit  &  looks its index up by a de Bruijn multiplication.
+     * Used in constant expressions  &  on compilers without bit scan builtins.
+     * @tparam TUnsigned
+     * @param x
+     * @return
+     */
+    template <typename TUnsigned>
+    [[nodiscard]] constexpr std::uint8_t
+    ctzDeBruijn_ (TUnsigned x) noexcept
+    {
+      using lut_type = CtzLut_ <8 * sizeof (TUnsigned)>;
+
+
+      if (x != 0)
+      {
+        // Truncating the product back to  `TUnsigned'  matters for the types narrower than  `int'.
+        const TUnsigned lowest_set_bit (x & TUnsigned (- x));
+
+        return lut_type::lut [TUnsigned (lowest_set_bit * TUnsigned (lut_type::factor)) >> lut_type::shift];
+      }
+
+      return lut_type::width;
+    }
   }
 
 
   /**
-   * @brief
+   * @brief Counts trailing zero bits;  returns the width of the type for zero.
+   * Compiles to  `tzcnt'/`bsf'  at run time,  falls back to a de Bruijn lookup in constant expressions.
    * @param x
    * @return
    */
@@ -173,15 +200,14 @@ namespace Utils
   [[nodiscard]] constexpr std::uint8_t
   ctz (std::uint8_t x) noexcept
   {
-    using lut_type = CtzInternals_::CtzLut_ <8>;
-
-
-    if (x != 0)
+#ifdef __GNUC__
+    if (! __builtin_is_constant_evaluated ())
     {
-      return lut_type::lut [((x & (- x)) * lut_type::factor) >> lut_type::shift];
+      return (x != 0) ? std::uint8_t (__builtin_ctz (x)) : std::uint8_t (8);
     }
+#endif  // __GNUC__
 
-    return lut_type::width;
+    return CtzInternals_::ctzDeBruijn_ (x);
   }
 
 
@@ -207,15 +233,14 @@ namespace Utils
   [[nodiscard]] constexpr std::uint8_t
   ctz (std::uint16_t x) noexcept
   {
-    using lut_type = CtzInternals_::CtzLut_ <16>;
-
-
-    if (x != 0)
+#ifdef __GNUC__
+    if (! __builtin_is_constant_evaluated ())
     {
-      return lut_type::lut [((x & (- x)) * lut_type::factor) >> lut_type::shift];
+      return (x != 0) ? std::uint8_t (__builtin_ctz (x)) : std::uint8_t (16);
     }
+#endif  // __GNUC__
 
-    return lut_type::width;
+    return CtzInternals_::ctzDeBruijn_ (x);
   }
 
 
@@ -241,15 +266,14 @@ namespace Utils
   constexpr std::uint8_t
   ctz (std::uint32_t x) noexcept
   {
-    using lut_type = CtzInternals_::CtzLut_ <32>;
-
-
-    if (x != 0)
+#ifdef __GNUC__
+    if (! __builtin_is_constant_evaluated ())
     {
-      return lut_type::lut [((x & (- x)) * lut_type::factor) >> lut_type::shift];
+      return (x != 0) ? std::uint8_t (__builtin_ctz (x)) : std::uint8_t (32);
     }
+#endif  // __GNUC__
 
-    return lut_type::width;
+    return CtzInternals_::ctzDeBruijn_ (x);
   }
 
 
@@ -275,15 +299,14 @@ namespace Utils
   constexpr std::uint8_t
   ctz (std::uint64_t x) noexcept
   {
-    using lut_type = CtzInternals_::CtzLut_ <64>;
-
-
-    if (x != 0)
+#ifdef __GNUC__
+    if (! __builtin_is_constant_evaluated ())
     {
-      return lut_type::lut [((x & (- x)) * lut_type::factor) >> lut_type::shift];
+      return (x != 0) ? std::uint8_t (__builtin_ctzll (x)) : std::uint8_t (64);
     }
+#endif  // __GNUC__
 
-    return lut_type::width;
+    return CtzInternals_::ctzDeBruijn_ (x);
   }
 
 
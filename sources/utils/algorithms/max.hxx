@@ -2,9 +2,14 @@
 #define UTILS_ALGORITHMS_MAX_HXX
 
 
-#include <type_traits>  // std::common_type_t
+#include <cstddef>  // std::size_t
+
+#include <iterator>  // std::{iterator_traits, random_access_iterator_tag}
+#include <type_traits>  // std::{common_type_t, is_base_of_v}
 #include <utility>  // std::forward
 
+#include "../config/min-max.hxx"  // Config::Utils::MinMax::Lanes
+
 
 namespace Utils
 {
@@ -44,6 +49,71 @@ namespace Utils
 
     return max (std::forward <TSecond> (second), std::forward <TRest> (rest) ...);
   }
+
+  /**
+   * @brief Returns the largest value in the non-empty range  [first, last),  comparing the same way as  `max'.
+   * Random access ranges are reduced with  `Lanes'  independent accumulators,  so the loop can be vectorized.
+   * @tparam TInputIterator
+   * @param first
+   * @param last
+   * @return
+   */
+  template <typename TInputIterator>
+  [[nodiscard]] constexpr typename std::iterator_traits <TInputIterator>::value_type
+  maxOf (TInputIterator first, TInputIterator last)
+  {
+    using difference_type = typename std::iterator_traits <TInputIterator>::difference_type;
+    using iterator_category = typename std::iterator_traits <TInputIterator>::iterator_category;
+    using value_type = typename std::iterator_traits <TInputIterator>::value_type;
+
+
+    value_type result (* first);
+
+    if constexpr (std::is_base_of_v <std::random_access_iterator_tag, iterator_category>)
+    {
+      constexpr std::size_t lanes (Config::Utils::MinMax::Lanes);
+
+      const std::size_t count (std::size_t (last - first));
+      value_type results [lanes] { };
+      for (std::size_t lane (0); lane < lanes; ++ lane)
+      {
+        results [lane] = result;
+      }
+
+      std::size_t index (0);
+      for (; index + lanes <= count; index += lanes)
+      {
+        for (std::size_t lane (0); lane < lanes; ++ lane)
+        {
+          const value_type x (first [difference_type (index + lane)]);
+          results [lane] = (results [lane] < x) ? x : results [lane];
+        }
+      }
+
+      for (; index < count; ++ index)
+      {
+        const value_type x (first [difference_type (index)]);
+        results [0] = (results [0] < x) ? x : results [0];
+      }
+
+      for (std::size_t lane (0); lane < lanes; ++ lane)
+      {
+        result = max (result, results [lane]);
+      }
+    }
+    else
+    {
+      ++ first;
+      while (first != last)
+      {
+        result = max (result, * first);
+
+        ++ first;
+      }
+    }
+
+    return result;
+  }
 }
 
 
@@ -13,6 +13,8 @@ namespace Utils
 {
   /**
    * @brief
+   * NOTE:  To get several moments in a single pass,  to process data in batches or on several threads,  use
+   *   `RunningStats'  or  `stats'  instead.
    * @tparam TInputIterator
    * @param first
    * @param last
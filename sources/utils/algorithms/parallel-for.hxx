@@ -0,0 +1,101 @@
+#ifndef UTILS_ALGORITHMS_PARALLELFOR_HXX
+#define UTILS_ALGORITHMS_PARALLELFOR_HXX
+
+
+#include <cstddef>  // std::size_t
+
+#include <system_error>  // std::system_error
+#include <thread>  // std::thread
+#include <vector>  // std::vector
+
+#include "../debug/assert.hxx"  // ASSERT
+#include "max.hxx"  // max
+#include "min.hxx"  // min
+
+
+namespace Utils
+{
+  /**
+   * @brief Splits the indices  [0, count)  into chunks of  `chunk_size'  indices  &  calls
+   *   `function (chunk_first, chunk_last)'  for each chunk on all available cores.
+   * Chunks are dealt to threads round-robin,  so chunking doesn't depend on the number of cores.
+   * `function'  must only touch data of its own chunk.
+   * If a thread can't be started,  its chunks are processed on the calling thread instead;
+   *   started threads are always joined before returning,  also when  `function'  throws on the calling thread.
+   * @tparam TFunction
+   * @param count
+   * @param chunk_size
+   * @param function
+   */
+  template <typename TFunction>
+  void
+  parallelFor (std::size_t count, std::size_t chunk_size, TFunction function)
+  {
+    ASSERT (chunk_size > 0, "`chunk_size'  must be greater than  `0'");
+
+    const std::size_t chunks_count ((count + chunk_size - 1) / chunk_size);
+    const std::size_t threads_count (
+      min (max (std::size_t (std::thread::hardware_concurrency ()), std::size_t (1)), chunks_count)
+    );
+
+    const auto process_chunks (
+      [count, chunk_size, chunks_count, threads_count, & function] (std::size_t thread_index)
+      {
+        for (std::size_t chunk (thread_index); chunk < chunks_count; chunk += threads_count)
+        {
+          const std::size_t chunk_first (chunk * chunk_size);
+
+          function (chunk_first, min (chunk_first + chunk_size, count));
+        }
+      }
+    );
+
+    std::vector <std::thread> threads;
+    std::size_t threads_started (1);
+    if (threads_count > 1)
+    {
+      threads.reserve (threads_count - 1);
+      try
+      {
+        for (; threads_started < threads_count; ++ threads_started)
+        {
+          threads.emplace_back (process_chunks, threads_started);
+        }
+      }
+      catch (const std::system_error &)
+      {
+        // Out of threads:  the chunks of the threads not started are processed below.
+      }
+    }
+
+    const auto join_threads (
+      [& threads] () noexcept
+      {
+        for (std::thread & thread : threads)
+        {
+          thread.join ();
+        }
+      }
+    );
+
+    try
+    {
+      process_chunks (0);
+
+      for (std::size_t thread_index (threads_started); thread_index < threads_count; ++ thread_index)
+      {
+        process_chunks (thread_index);
+      }
+    }
+    catch (...)
+    {
+      join_threads ();
+      throw;
+    }
+
+    join_threads ();
+  }
+}
+
+
+#endif  // UTILS_ALGORITHMS_PARALLELFOR_HXX
@@ -0,0 +1,63 @@
+#ifndef UTILS_ALGORITHMS_PARALLELREDUCE_HXX
+#define UTILS_ALGORITHMS_PARALLELREDUCE_HXX
+
+
+#include <cstddef>  // std::size_t
+
+#include <iterator>  // std::iterator_traits
+#include <vector>  // std::vector
+
+#include "../debug/assert.hxx"  // ASSERT
+#include "parallel-for.hxx"  // parallelFor
+
+
+namespace Utils
+{
+  /**
+   * @brief Splits the range  [first, last)  into chunks of  `chunk_size'  elements,  accumulates each chunk into its
+   *   own  `TAccumulator'  on all available cores  &  merges the partial results in the order of chunks.
+   * Chunking doesn't depend on the number of cores  (see  `parallelFor'),  so the result is the same on every machine.
+   * `accumulate (accumulator, chunk_first, chunk_last)'  must only touch its own  `accumulator',
+   *   `TAccumulator'  must provide  `merge (const TAccumulator &)'.
+   * @tparam TAccumulator
+   * @tparam TRandomAccessIterator
+   * @tparam TAccumulate
+   * @param first
+   * @param last
+   * @param chunk_size
+   * @param accumulate
+   * @return
+   */
+  template <typename TAccumulator, typename TRandomAccessIterator, typename TAccumulate>
+  [[nodiscard]] TAccumulator
+  parallelReduce (TRandomAccessIterator first, TRandomAccessIterator last, std::size_t chunk_size, TAccumulate accumulate)
+  {
+    using difference_type = typename std::iterator_traits <TRandomAccessIterator>::difference_type;
+
+
+    ASSERT (chunk_size > 0, "`chunk_size'  must be greater than  `0'");
+
+    std::vector <TAccumulator> partial_results ((std::size_t (last - first) + chunk_size - 1) / chunk_size);
+    parallelFor (
+      std::size_t (last - first), chunk_size,
+      [first, chunk_size, & partial_results, & accumulate] (std::size_t chunk_first, std::size_t chunk_last)
+      {
+        accumulate (
+          partial_results [chunk_first / chunk_size],
+          first + difference_type (chunk_first), first + difference_type (chunk_last)
+        );
+      }
+    );
+
+    TAccumulator result;
+    for (const TAccumulator & partial_result : partial_results)
+    {
+      result.merge (partial_result);
+    }
+
+    return result;
+  }
+}
+
+
+#endif  // UTILS_ALGORITHMS_PARALLELREDUCE_HXX
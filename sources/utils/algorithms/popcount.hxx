@@ -0,0 +1,70 @@
+#ifndef UTILS_ALGORITHMS_POPCOUNT_HXX
+#define UTILS_ALGORITHMS_POPCOUNT_HXX
+
+
+#include <cstdint>  // std::{uint8_t, uint64_t}
+
+#include <type_traits>  // std::{is_integral_v, make_unsigned_t}
+
+
+namespace Utils
+{
+  namespace PopcountInternals_
+  {
+    /**
+     * @brief Portable  `popcount':  sums bits in parallel within the word  ("SWAR").
+     * @param x
+     * @return
+     */
+    [[nodiscard]] constexpr std::uint8_t
+    popcountSwar_ (std::uint64_t x) noexcept
+    {
+      x = x - ((x >> 1) & 0x5555'5555'5555'5555);
+      x = (x & 0x3333'3333'3333'3333) + ((x >> 2) & 0x3333'3333'3333'3333);
+      x = (x + (x >> 4)) & 0x0f0f'0f0f'0f0f'0f0f;
+
+      return std::uint8_t ((x * 0x0101'0101'0101'0101) >> 56);
+    }
+  }
+
+
+  /**
+   * @brief Counts set bits.
+   * Compiles to  `popcnt'  at run time when the target has it  (e. g.  `-mpopcnt'  or  `-march=native');
+   *   otherwise the builtin becomes a library call that's slower than  `PopcountInternals_::popcountSwar_',
+   *   so the latter is used,  as well as in constant expressions.
+   * @tparam TIntegral
+   * @param x
+   * @return
+   */
+  template <typename TIntegral>
+  [[nodiscard]] constexpr std::uint8_t
+  popcount (TIntegral x) noexcept
+  {
+    static_assert (std::is_integral_v <TIntegral>);
+
+    using unsigned_type = std::make_unsigned_t <TIntegral>;
+
+
+    const unsigned_type bits ((unsigned_type (x)));
+
+#if defined (__GNUC__) && defined (__POPCNT__)
+    if (! __builtin_is_constant_evaluated ())
+    {
+      if constexpr (sizeof (unsigned_type) <= sizeof (unsigned int))
+      {
+        return std::uint8_t (__builtin_popcount (bits));
+      }
+      else
+      {
+        return std::uint8_t (__builtin_popcountll (bits));
+      }
+    }
+#endif  // defined (__GNUC__) && defined (__POPCNT__)
+
+    return PopcountInternals_::popcountSwar_ (bits);
+  }
+}
+
+
+#endif  // UTILS_ALGORITHMS_POPCOUNT_HXX
@@ -0,0 +1,472 @@
+#ifndef UTILS_ALGORITHMS_RUNNINGSTATS_HXX
+#define UTILS_ALGORITHMS_RUNNINGSTATS_HXX
+
+
+#include <cstddef>  // std::size_t
+#include <cmath>  // std::sqrt
+
+#include <iterator>  // std::{iterator_traits, random_access_iterator_tag}
+#include <limits>  // std::numeric_limits
+#include <ostream>  // std::ostream
+#include <type_traits>  // std::{is_base_of_v, is_floating_point_v}
+
+#include "../config/running-stats.hxx"  // Config::Utils::RunningStats::{Block_size, Lanes}
+#include "max.hxx"  // max
+#include "min.hxx"  // min
+
+
+namespace Utils
+{
+  /**
+   * @brief Single-pass accumulator of count,  mean,  central moments  M2,  M3,  M4,  minimum  &  maximum.
+   * Accumulators built over different parts of the data can be merged exactly,  so shards may be processed on
+   *   different threads  (see  `stats').
+   * For the reference see:
+   * [1] `https://en.wikipedia.org/wiki/Algorithms_for_calculating_variance#Higher-order_statistics';
+   * [2] Chan,  Tony F.;  Golub,  Gene H.;  LeVeque,  Randall J.  (1979).  Updating Formulae and a Pairwise Algorithm
+   *   for Computing Sample Variances.  Technical Report STAN-CS-79-773;
+   * [3] Pébay,  Philippe  (2008).  Formulas for Robust,  One-Pass Parallel Computation of Covariances and
+   *   Arbitrary-Order Statistical Moments.  Technical Report SAND2008-6212,  doi:10.2172/1028931.
+   * @tparam TValue
+   */
+  template <typename TValue>
+  class RunningStats final
+  {
+    static_assert (std::is_floating_point_v <TValue>);
+
+
+    public:
+      /**
+       * @brief
+       */
+      using value_type = TValue;
+
+
+    private:
+      /**
+       * @brief
+       */
+      using self_type = RunningStats;
+
+
+    public:
+      /**
+       * @brief
+       * @return
+       */
+      constexpr RunningStats () noexcept = default;
+
+      /**
+       * @brief
+       * @param that
+       * @return
+       */
+      constexpr RunningStats (const self_type & that [[maybe_unused]]) noexcept = default;
+
+      /**
+       * @brief
+       * @param that
+       * @return
+       */
+      constexpr RunningStats (self_type && that [[maybe_unused]]) noexcept = default;
+
+
+      /**
+       * @brief
+       * @return
+       */
+      [[nodiscard]] constexpr std::size_t
+      count () const noexcept
+      {
+        return count_;
+      }
+
+
+      /**
+       * @brief
+       * @return
+       */
+      [[nodiscard]] constexpr value_type
+      mean () const noexcept
+      {
+        return mean_;
+      }
+
+
+      /**
+       * @brief Sample variance;  requires at least two values.
+       * @return
+       */
+      [[nodiscard]] constexpr value_type
+      variance () const noexcept
+      {
+        return m_2_ / value_type (count_ - 1);
+      }
+
+
+      /**
+       * @brief
+       * @return
+       */
+      [[nodiscard]] constexpr value_type
+      populationVariance () const noexcept
+      {
+        return m_2_ / value_type (count_);
+      }
+
+
+      /**
+       * @brief
+       * @return
+       */
+      [[nodiscard]] value_type
+      standardDeviation () const noexcept
+      {
+        return std::sqrt (variance ());
+      }
+
+
+      /**
+       * @brief
+       * @return
+       */
+      [[nodiscard]] value_type
+      skewness () const noexcept
+      {
+        return std::sqrt (value_type (count_)) * m_3_ / (m_2_ * std::sqrt (m_2_));
+      }
+
+
+      /**
+       * @brief Excess kurtosis.
+       * @return
+       */
+      [[nodiscard]] constexpr value_type
+      kurtosis () const noexcept
+      {
+        return value_type (count_) * m_4_ / (m_2_ * m_2_) - value_type (3);
+      }
+
+
+      /**
+       * @brief
+       * @return
+       */
+      [[nodiscard]] constexpr value_type
+      minimum () const noexcept
+      {
+        return minimum_;
+      }
+
+
+      /**
+       * @brief
+       * @return
+       */
+      [[nodiscard]] constexpr value_type
+      maximum () const noexcept
+      {
+        return maximum_;
+      }
+
+
+      /**
+       * @brief
+       * NaN propagates to the moments but is ignored by minimum  &  maximum,  on the batch path too.
+       * @param x
+       */
+      constexpr void
+      push (value_type x) noexcept
+      {
+        const value_type n_1 ((value_type (count_)));
+        ++ count_;
+        const value_type n ((value_type (count_)));
+
+        const value_type delta (x - mean_);
+        const value_type delta_n (delta / n);
+        const value_type delta_n_2 (delta_n * delta_n);
+        const value_type term_1 (delta * delta_n * n_1);
+
+        mean_ += delta_n;
+        m_4_ += term_1 * delta_n_2 * (n * n - value_type (3) * n + value_type (3))
+              + value_type (6) * delta_n_2 * m_2_
+              - value_type (4) * delta_n * m_3_;
+        m_3_ += term_1 * delta_n * (n - value_type (2)) - value_type (3) * delta_n * m_2_;
+        m_2_ += term_1;
+
+        minimum_ = (x < minimum_) ? x : minimum_;
+        maximum_ = (maximum_ < x) ? x : maximum_;
+      }
+
+
+      /**
+       * @brief
+       * Random access ranges take the batch path,  see  `push (const value_type *,  std::size_t)'.
+       * @tparam TInputIterator
+       * @param first
+       * @param last
+       */
+      template <typename TInputIterator>
+      constexpr void
+      push (TInputIterator first, TInputIterator last) noexcept
+      {
+        using difference_type = typename std::iterator_traits <TInputIterator>::difference_type;
+        using iterator_category = typename std::iterator_traits <TInputIterator>::iterator_category;
+
+
+        if constexpr (std::is_base_of_v <std::random_access_iterator_tag, iterator_category>)
+        {
+          constexpr std::size_t block_size (Config::Utils::RunningStats::Block_size);
+
+          const std::size_t count (std::size_t (last - first));
+          for (std::size_t index (0); index < count; index += block_size)
+          {
+            pushBlock_ (first + difference_type (index), min (block_size, count - index));
+          }
+        }
+        else
+        {
+          while (first != last)
+          {
+            push (value_type (* first));
+
+            ++ first;
+          }
+        }
+      }
+
+
+      /**
+       * @brief Batch path:  values are processed in blocks of  `Block_size'.
+       * Moments of each block are computed about its own mean,  with a single division per block  &  `Lanes'
+       *   independent accumulators,  then the block is merged in.
+       * @param values
+       * @param count
+       */
+      constexpr void
+      push (const value_type * values, std::size_t count) noexcept
+      {
+        push (values, values + count);
+      }
+
+
+      /**
+       * @brief Merges statistics accumulated by  `that'  (see  [2],  [3]).
+       * @param that
+       */
+      constexpr void
+      merge (const self_type & that) noexcept
+      {
+        if (that.count_ == 0)
+        {
+          return;
+        }
+
+        if (count_ == 0)
+        {
+          * this = that;
+
+          return;
+        }
+
+        const value_type n_a ((value_type (count_)));
+        const value_type n_b ((value_type (that.count_)));
+        const value_type n (n_a + n_b);
+
+        const value_type delta (that.mean_ - mean_);
+        const value_type delta_n (delta / n);
+        const value_type delta_n_2 (delta_n * delta_n);
+        const value_type n_a_n_b (n_a * n_b);
+
+        const value_type m_4 (
+            m_4_ + that.m_4_
+          + delta * delta_n * delta_n_2 * n_a_n_b * (n_a * n_a - n_a_n_b + n_b * n_b)
+          + value_type (6) * delta_n_2 * (n_a * n_a * that.m_2_ + n_b * n_b * m_2_)
+          + value_type (4) * delta_n * (n_a * that.m_3_ - n_b * m_3_)
+        );
+        const value_type m_3 (
+            m_3_ + that.m_3_
+          + delta * delta_n_2 * n_a_n_b * (n_a - n_b)
+          + value_type (3) * delta_n * (n_a * that.m_2_ - n_b * m_2_)
+        );
+        const value_type m_2 (m_2_ + that.m_2_ + delta * delta_n * n_a_n_b);
+
+        count_ += that.count_;
+        mean_ += delta_n * n_b;
+        m_2_ = m_2;
+        m_3_ = m_3;
+        m_4_ = m_4;
+        minimum_ = min (minimum_, that.minimum_);
+        maximum_ = max (maximum_, that.maximum_);
+      }
+
+
+      /**
+       * @brief
+       * @param that
+       * @return
+       */
+      constexpr self_type &
+      operator = (const self_type & that [[maybe_unused]]) noexcept = default;
+
+      /**
+       * @brief
+       * @param that
+       * @return
+       */
+      constexpr self_type &
+      operator = (self_type && that [[maybe_unused]]) noexcept = default;
+
+
+      /**
+       * @brief
+       * @param output
+       * @param self
+       * @return
+       */
+      friend std::ostream &
+      operator << (std::ostream & output, const self_type & self)
+      {
+        output
+          << "RunningStats{" << self.count_ << ", " << self.mean_ << ", " << self.m_2_
+          << ", " << self.minimum_ << ", " << self.maximum_ << '}';
+
+        return output;
+      }
+
+
+    private:
+      /**
+       * @brief
+       * @tparam TRandomAccessIterator
+       * @param first
+       * @param count
+       */
+      template <typename TRandomAccessIterator>
+      constexpr void
+      pushBlock_ (TRandomAccessIterator first, std::size_t count) noexcept
+      {
+        using difference_type = typename std::iterator_traits <TRandomAccessIterator>::difference_type;
+
+
+        constexpr std::size_t lanes (Config::Utils::RunningStats::Lanes);
+
+        // Seeded like  `minimum_'  &  `maximum_',  so NaN is skipped by the same comparisons as in  `push'.
+        value_type sums [lanes] { };
+        value_type minima [lanes] { };
+        value_type maxima [lanes] { };
+        for (std::size_t lane (0); lane < lanes; ++ lane)
+        {
+          minima [lane] = std::numeric_limits <value_type>::infinity ();
+          maxima [lane] = - std::numeric_limits <value_type>::infinity ();
+        }
+
+        std::size_t index (0);
+        for (; index + lanes <= count; index += lanes)
+        {
+          for (std::size_t lane (0); lane < lanes; ++ lane)
+          {
+            const value_type x (first [difference_type (index + lane)]);
+            sums [lane] += x;
+            minima [lane] = (x < minima [lane]) ? x : minima [lane];
+            maxima [lane] = (maxima [lane] < x) ? x : maxima [lane];
+          }
+        }
+
+        for (; index < count; ++ index)
+        {
+          const value_type x (first [difference_type (index)]);
+          sums [0] += x;
+          minima [0] = (x < minima [0]) ? x : minima [0];
+          maxima [0] = (maxima [0] < x) ? x : maxima [0];
+        }
+
+        self_type block;
+        block.count_ = count;
+        block.minimum_ = minima [0];
+        block.maximum_ = maxima [0];
+        value_type sum (0);
+        for (std::size_t lane (0); lane < lanes; ++ lane)
+        {
+          sum += sums [lane];
+          block.minimum_ = min (block.minimum_, minima [lane]);
+          block.maximum_ = max (block.maximum_, maxima [lane]);
+        }
+
+        block.mean_ = sum / value_type (count);
+
+        value_type m_2s [lanes] { };
+        value_type m_3s [lanes] { };
+        value_type m_4s [lanes] { };
+        index = 0;
+        for (; index + lanes <= count; index += lanes)
+        {
+          for (std::size_t lane (0); lane < lanes; ++ lane)
+          {
+            const value_type delta (value_type (first [difference_type (index + lane)]) - block.mean_);
+            const value_type delta_2 (delta * delta);
+            m_2s [lane] += delta_2;
+            m_3s [lane] += delta_2 * delta;
+            m_4s [lane] += delta_2 * delta_2;
+          }
+        }
+
+        for (; index < count; ++ index)
+        {
+          const value_type delta (value_type (first [difference_type (index)]) - block.mean_);
+          const value_type delta_2 (delta * delta);
+          m_2s [0] += delta_2;
+          m_3s [0] += delta_2 * delta;
+          m_4s [0] += delta_2 * delta_2;
+        }
+
+        for (std::size_t lane (0); lane < lanes; ++ lane)
+        {
+          block.m_2_ += m_2s [lane];
+          block.m_3_ += m_3s [lane];
+          block.m_4_ += m_4s [lane];
+        }
+
+        merge (block);
+      }
+
+
+      /**
+       * @brief
+       */
+      std::size_t count_ { };
+
+      /**
+       * @brief
+       */
+      value_type mean_ { };
+
+      /**
+       * @brief Sum of squared deviations from the mean.
+       */
+      value_type m_2_ { };
+
+      /**
+       * @brief Sum of cubed deviations from the mean.
+       */
+      value_type m_3_ { };
+
+      /**
+       * @brief Sum of 4th powers of deviations from the mean.
+       */
+      value_type m_4_ { };
+
+      /**
+       * @brief
+       */
+      value_type minimum_ { std::numeric_limits <value_type>::infinity () };
+
+      /**
+       * @brief
+       */
+      value_type maximum_ { - std::numeric_limits <value_type>::infinity () };
+  };
+}
+
+
+#endif  // UTILS_ALGORITHMS_RUNNINGSTATS_HXX
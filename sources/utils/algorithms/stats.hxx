@@ -0,0 +1,60 @@
+#ifndef UTILS_ALGORITHMS_STATS_HXX
+#define UTILS_ALGORITHMS_STATS_HXX
+
+
+#include <cstddef>  // std::size_t
+
+#include <iterator>  // std::{iterator_traits, random_access_iterator_tag}
+#include <type_traits>  // std::is_base_of_v
+
+#include "../config/running-stats.hxx"  // Config::Utils::RunningStats::{Parallel_chunk_size, Parallel_threshold}
+#include "parallel-reduce.hxx"  // parallelReduce
+#include "running-stats.hxx"  // RunningStats
+
+
+namespace Utils
+{
+  /**
+   * @brief Collects statistics of the range  [first, last)  in a single pass.
+   * Big random access ranges are split into chunks of  `Parallel_chunk_size'  values which are processed on all
+   *   available cores  (see  `parallelReduce').
+   * @tparam TInputIterator
+   * @tparam TValue
+   * @param first
+   * @param last
+   * @return
+   */
+  template <
+    typename TInputIterator,
+    typename TValue = typename std::iterator_traits <TInputIterator>::value_type
+  >
+  [[nodiscard]] RunningStats <TValue>
+  stats (TInputIterator first, TInputIterator last)
+  {
+    using iterator_category = typename std::iterator_traits <TInputIterator>::iterator_category;
+    using stats_type = RunningStats <TValue>;
+
+
+    if constexpr (std::is_base_of_v <std::random_access_iterator_tag, iterator_category>)
+    {
+      if (! (std::size_t (last - first) < Config::Utils::RunningStats::Parallel_threshold))
+      {
+        return parallelReduce <stats_type> (
+          first, last, Config::Utils::RunningStats::Parallel_chunk_size,
+          [] (stats_type & partial_stats, TInputIterator chunk_first, TInputIterator chunk_last)
+          {
+            partial_stats.push (chunk_first, chunk_last);
+          }
+        );
+      }
+    }
+
+    stats_type result;
+    result.push (first, last);
+
+    return result;
+  }
+}
+
+
+#endif  // UTILS_ALGORITHMS_STATS_HXX
@@ -0,0 +1,66 @@
+#ifndef UTILS_ALGORITHMS_SUM_HXX
+#define UTILS_ALGORITHMS_SUM_HXX
+
+
+#include <cstddef>  // std::size_t
+
+#include <iterator>  // std::{iterator_traits, random_access_iterator_tag}
+#include <type_traits>  // std::{is_arithmetic_v, is_base_of_v}
+
+#include "../config/summator.hxx"  // Config::Utils::Summator::{Parallel_chunk_size, Parallel_threshold}
+#include "parallel-reduce.hxx"  // parallelReduce
+#include "summator.hxx"  // Summator
+
+
+namespace Utils
+{
+  /**
+   * @brief Sums the range  [first, last)  using  `TSummator'.
+   * Big random access ranges are split into chunks of  `Parallel_chunk_size'  terms which are summed on all
+   *   available cores  (see  `parallelReduce').
+   * @tparam TInputIterator
+   * @tparam TSummator
+   * @param first
+   * @param last
+   * @return
+   */
+  template <
+    typename TInputIterator,
+    typename TSummator = Summator <typename std::iterator_traits <TInputIterator>::value_type>
+  >
+  [[nodiscard]] typename TSummator::term_type
+  sum (TInputIterator first, TInputIterator last)
+  {
+    using iterator_category = typename std::iterator_traits <TInputIterator>::iterator_category;
+    using term_type = typename TSummator::term_type;
+
+
+    static_assert (std::is_arithmetic_v <term_type>);
+
+    if constexpr (std::is_base_of_v <std::random_access_iterator_tag, iterator_category>)
+    {
+      if (! (std::size_t (last - first) < Config::Utils::Summator::Parallel_threshold))
+      {
+        const TSummator total (
+          parallelReduce <TSummator> (
+            first, last, Config::Utils::Summator::Parallel_chunk_size,
+            [] (TSummator & partial_sum, TInputIterator chunk_first, TInputIterator chunk_last)
+            {
+              partial_sum.add (chunk_first, chunk_last);
+            }
+          )
+        );
+
+        return term_type (total);
+      }
+    }
+
+    TSummator total;
+    total.add (first, last);
+
+    return term_type (total);
+  }
+}
+
+
+#endif  // UTILS_ALGORITHMS_SUM_HXX
@@ -2,11 +2,18 @@
 #define UTILS_ALGORITHMS_SUMMATOR_HXX
 
 
+#include <cstddef>  // std::size_t
+#include <cstdint>  // std::uint64_t
+
+#include <iterator>  // std::{iterator_traits, random_access_iterator_tag}
+#include <limits>  // std::numeric_limits
 #include <ostream>  // std::ostream
-#include <type_traits>  // std::{is_arithmetic_v, is_floating_point_v, is_integral_v}
+#include <type_traits>  // std::{is_arithmetic_v, is_base_of_v, is_floating_point_v, is_integral_v}
 
+#include "../config/summator.hxx"  // Config::Utils::Summator::{Lanes, Pairwise_block_size}
 #include "../meta/choose.hxx"  // ChooseT
 #include "../meta/if-then.hxx"  // IfThen
+#include "abs.hxx"  // abs
 
 
 namespace Utils
@@ -90,6 +97,56 @@ namespace Utils
       }
 
 
+      /**
+       * @brief Adds  `count'  terms starting at  `first'.
+       * The terms are spread over  `Lanes'  independent accumulators,  so there's no single dependency chain  &  the
+       *   inner loop can be vectorized.
+       * @tparam TRandomAccessIterator
+       * @param first
+       * @param count
+       */
+      template <typename TRandomAccessIterator>
+      constexpr void
+      add (TRandomAccessIterator first, std::size_t count) noexcept
+      {
+        using difference_type = typename std::iterator_traits <TRandomAccessIterator>::difference_type;
+
+
+        constexpr std::size_t lanes (Config::Utils::Summator::Lanes);
+
+        term_type partial_sums [lanes] { };
+        std::size_t index (0);
+        for (; index + lanes <= count; index += lanes)
+        {
+          for (std::size_t lane (0); lane < lanes; ++ lane)
+          {
+            partial_sums [lane] += term_type (first [difference_type (index + lane)]);
+          }
+        }
+
+        for (std::size_t lane (0); lane < lanes; ++ lane)
+        {
+          sum_ += partial_sums [lane];
+        }
+
+        for (; index < count; ++ index)
+        {
+          add (term_type (first [difference_type (index)]));
+        }
+      }
+
+
+      /**
+       * @brief Adds partial sum accumulated by  `that'.
+       * @param that
+       */
+      constexpr void
+      merge (const self_type & that) noexcept
+      {
+        sum_ += that.sum_;
+      }
+
+
       /**
        * @brief
        * @param that
@@ -194,7 +251,8 @@ namespace Utils
       [[nodiscard]] constexpr term_type
       total () const noexcept
       {
-        return sum_ + correction_;
+        // `correction_'  holds the negated low-order part,  see  `add':
+        return sum_ - correction_;
       }
 
 
@@ -250,6 +308,62 @@ namespace Utils
       }
 
 
+      /**
+       * @brief Adds  `count'  terms starting at  `first'.
+       * Each of  `Lanes'  independent accumulators runs its own compensated summation,  then the lanes are merged in
+       *   order,  so the result doesn't depend on the target instruction set.
+       * @tparam TRandomAccessIterator
+       * @param first
+       * @param count
+       */
+      template <typename TRandomAccessIterator>
+      constexpr void
+      add (TRandomAccessIterator first, std::size_t count) noexcept
+      {
+        using difference_type = typename std::iterator_traits <TRandomAccessIterator>::difference_type;
+
+
+        constexpr std::size_t lanes (Config::Utils::Summator::Lanes);
+
+        term_type sums [lanes] { };
+        term_type corrections [lanes] { };
+        std::size_t index (0);
+        for (; index + lanes <= count; index += lanes)
+        {
+          for (std::size_t lane (0); lane < lanes; ++ lane)
+          {
+            const term_type corrected_term (term_type (first [difference_type (index + lane)]) - corrections [lane]);
+            const term_type new_sum (sums [lane] + corrected_term);
+            corrections [lane] = (new_sum - sums [lane]) - corrected_term;
+            sums [lane] = new_sum;
+          }
+        }
+
+        for (std::size_t lane (0); lane < lanes; ++ lane)
+        {
+          add (sums [lane]);
+          add (- corrections [lane]);
+        }
+
+        for (; index < count; ++ index)
+        {
+          add (term_type (first [difference_type (index)]));
+        }
+      }
+
+
+      /**
+       * @brief Adds partial sum accumulated by  `that',  including its compensation.
+       * @param that
+       */
+      constexpr void
+      merge (const self_type & that) noexcept
+      {
+        add (that.sum_);
+        add (- that.correction_);
+      }
+
+
       /**
        * @brief
        * @param that
@@ -300,6 +414,480 @@ namespace Utils
   };
 
 
+  /**
+   * @brief
+   * @tparam TTerm
+   */
+  template <typename TTerm>
+  class NeumaierSummationPolicy final
+  {
+    static_assert (std::is_floating_point_v <TTerm>);
+
+
+    public:
+      /**
+       * @brief
+       */
+      using term_type = TTerm;
+
+
+    private:
+      /**
+       * @brief
+       */
+      using self_type = NeumaierSummationPolicy;
+
+
+    public:
+      /**
+       * @brief
+       * @return
+       */
+      constexpr NeumaierSummationPolicy () noexcept = default;
+
+      /**
+       * @brief
+       * @param that
+       * @return
+       */
+      constexpr NeumaierSummationPolicy (const self_type & that [[maybe_unused]]) noexcept = default;
+
+      /**
+       * @brief
+       * @param that
+       * @return
+       */
+      constexpr NeumaierSummationPolicy (self_type && that [[maybe_unused]]) noexcept = default;
+
+
+      /**
+       * @brief
+       * @param initial_value
+       * @return
+       */
+      constexpr explicit NeumaierSummationPolicy (term_type initial_value) noexcept :
+        sum_ (initial_value)
+      { }
+
+
+      /**
+       * @brief
+       * @return
+       */
+      [[nodiscard]] constexpr term_type
+      total () const noexcept
+      {
+        return sum_ + correction_;
+      }
+
+
+      /**
+       * @brief Neumaier's improved Kahan--Babuska summation.
+       * Unlike Kahan's method,  the correction is not fed back into the next term but accumulated separately,  &  the
+       *   roles of the partial sum  &  the term are swapped when the term is bigger in magnitude,  so the low-order
+       *   bits of the bigger operand are never lost.
+       * For the reference see:
+       * [1] Neumaier,  Arnold  (1974).  Rundungsfehleranalyse einiger Verfahren zur Summation endlicher Summen,
+       *   doi:10.1002/zamm.19740540106;
+       * [2] `https://en.wikipedia.org/wiki/Kahan_summation_algorithm#Further_enhancements'.
+       * @param term
+       */
+      constexpr void
+      add (term_type term) noexcept
+      {
+        const term_type new_sum (sum_ + term);
+        correction_ += step_ (sum_, term, new_sum);
+        sum_ = new_sum;
+      }
+
+
+      /**
+       * @brief Adds  `count'  terms starting at  `first'.
+       * Each of  `Lanes'  independent accumulators runs its own compensated summation,  then the lanes are merged in
+       *   order,  so the result doesn't depend on the target instruction set.
+       * @tparam TRandomAccessIterator
+       * @param first
+       * @param count
+       */
+      template <typename TRandomAccessIterator>
+      constexpr void
+      add (TRandomAccessIterator first, std::size_t count) noexcept
+      {
+        using difference_type = typename std::iterator_traits <TRandomAccessIterator>::difference_type;
+
+
+        constexpr std::size_t lanes (Config::Utils::Summator::Lanes);
+
+        term_type sums [lanes] { };
+        term_type corrections [lanes] { };
+        std::size_t index (0);
+        for (; index + lanes <= count; index += lanes)
+        {
+          for (std::size_t lane (0); lane < lanes; ++ lane)
+          {
+            const term_type term (first [difference_type (index + lane)]);
+            const term_type new_sum (sums [lane] + term);
+            corrections [lane] += step_ (sums [lane], term, new_sum);
+            sums [lane] = new_sum;
+          }
+        }
+
+        for (std::size_t lane (0); lane < lanes; ++ lane)
+        {
+          add (sums [lane]);
+          correction_ += corrections [lane];
+        }
+
+        for (; index < count; ++ index)
+        {
+          add (term_type (first [difference_type (index)]));
+        }
+      }
+
+
+      /**
+       * @brief Adds partial sum accumulated by  `that',  including its compensation.
+       * @param that
+       */
+      constexpr void
+      merge (const self_type & that) noexcept
+      {
+        add (that.sum_);
+        correction_ += that.correction_;
+      }
+
+
+      /**
+       * @brief
+       * @param that
+       * @return
+       */
+      constexpr self_type &
+      operator = (const self_type & that [[maybe_unused]]) noexcept = default;
+
+      /**
+       * @brief
+       * @param that
+       * @return
+       */
+      constexpr self_type &
+      operator = (self_type && that [[maybe_unused]]) noexcept = default;
+
+
+      /**
+       * @brief
+       * @param new_initial_value
+       * @return
+       */
+      constexpr self_type &
+      operator = (term_type new_initial_value) noexcept
+      {
+        sum_ = new_initial_value;
+        correction_ = term_zero_;
+
+        return * this;
+      }
+
+
+    private:
+      /**
+       * @brief Returns the rounding error of  `sum + term == new_sum'.
+       * Written as a select rather than a branch,  so it can be vectorized.
+       * @param sum
+       * @param term
+       * @param new_sum
+       * @return
+       */
+      [[nodiscard]] static constexpr term_type
+      step_ (term_type sum, term_type term, term_type new_sum) noexcept
+      {
+        return (abs (sum) < abs (term)) ? ((term - new_sum) + sum) : ((sum - new_sum) + term);
+      }
+
+
+      /**
+       * @brief
+       */
+      term_type sum_ { };
+
+      /**
+       * @brief A running compensation for lost low-order bits.
+       */
+      term_type correction_ { };
+
+      /**
+       * @brief
+       */
+      static constexpr term_type term_zero_ { };
+  };
+
+
+  /**
+   * @brief
+   * @tparam TTerm
+   */
+  template <typename TTerm>
+  class PairwiseSummationPolicy final
+  {
+    static_assert (std::is_arithmetic_v <TTerm>);
+
+
+    public:
+      /**
+       * @brief
+       */
+      using term_type = TTerm;
+
+
+    private:
+      /**
+       * @brief
+       */
+      using self_type = PairwiseSummationPolicy;
+
+
+    public:
+      /**
+       * @brief
+       * @return
+       */
+      constexpr PairwiseSummationPolicy () noexcept = default;
+
+      /**
+       * @brief
+       * @param that
+       * @return
+       */
+      constexpr PairwiseSummationPolicy (const self_type & that [[maybe_unused]]) noexcept = default;
+
+      /**
+       * @brief
+       * @param that
+       * @return
+       */
+      constexpr PairwiseSummationPolicy (self_type && that [[maybe_unused]]) noexcept = default;
+
+
+      /**
+       * @brief
+       * @param initial_value
+       * @return
+       */
+      constexpr explicit PairwiseSummationPolicy (term_type initial_value) noexcept :
+        block_sum_ (initial_value)
+      { }
+
+
+      /**
+       * @brief Adds up the pending levels from the smallest to the biggest one.
+       * @return
+       */
+      [[nodiscard]] constexpr term_type
+      total () const noexcept
+      {
+        term_type result (block_sum_);
+        for (std::size_t level (0); level < levels_count_; ++ level)
+        {
+          if ((blocks_count_ & (std::uint64_t (1) << level)) != 0)
+          {
+            result += levels_ [level];
+          }
+        }
+
+        return result;
+      }
+
+
+      /**
+       * @brief Streaming pairwise  (cascade)  summation.
+       * Terms are summed naively in blocks of  `Pairwise_block_size',  then the block sums are combined like the
+       *   digits of a binary counter,  so that only sums of equal number of terms are ever added together.
+       * The error bound grows as  O (eps log n)  instead of  O (eps n),  while the per-term cost stays close to the
+       *   naive summation.
+       * For the reference see:
+       * [1] Higham,  Nicholas J.  (1993).  The accuracy of floating point summation,  doi:10.1137/0914050;
+       * [2] `https://en.wikipedia.org/wiki/Pairwise_summation'.
+       * @param term
+       */
+      constexpr void
+      add (term_type term) noexcept
+      {
+        block_sum_ += term;
+        ++ block_size_;
+
+        if (block_size_ == block_capacity_)
+        {
+          push_ (block_sum_);
+          block_sum_ = term_zero_;
+          block_size_ = 0;
+        }
+      }
+
+
+      /**
+       * @brief Adds  `count'  terms starting at  `first'.
+       * Whole blocks are summed with  `Lanes'  independent accumulators.
+       * @tparam TRandomAccessIterator
+       * @param first
+       * @param count
+       */
+      template <typename TRandomAccessIterator>
+      constexpr void
+      add (TRandomAccessIterator first, std::size_t count) noexcept
+      {
+        using difference_type = typename std::iterator_traits <TRandomAccessIterator>::difference_type;
+
+
+        constexpr std::size_t lanes (Config::Utils::Summator::Lanes);
+
+        std::size_t index (0);
+        for (; (index < count) && (block_size_ != 0); ++ index)
+        {
+          add (term_type (first [difference_type (index)]));
+        }
+
+        for (; index + block_capacity_ <= count; index += block_capacity_)
+        {
+          term_type partial_sums [lanes] { };
+          std::size_t offset (0);
+          for (; offset + lanes <= block_capacity_; offset += lanes)
+          {
+            for (std::size_t lane (0); lane < lanes; ++ lane)
+            {
+              partial_sums [lane] += term_type (first [difference_type (index + offset + lane)]);
+            }
+          }
+
+          for (; offset < block_capacity_; ++ offset)
+          {
+            partial_sums [0] += term_type (first [difference_type (index + offset)]);
+          }
+
+          term_type partial_sum (term_zero_);
+          for (std::size_t lane (0); lane < lanes; ++ lane)
+          {
+            partial_sum += partial_sums [lane];
+          }
+
+          push_ (partial_sum);
+        }
+
+        for (; index < count; ++ index)
+        {
+          add (term_type (first [difference_type (index)]));
+        }
+      }
+
+
+      /**
+       * @brief Adds partial sums accumulated by  `that'.
+       * @param that
+       */
+      constexpr void
+      merge (const self_type & that) noexcept
+      {
+        for (std::size_t level (0); level < levels_count_; ++ level)
+        {
+          if ((that.blocks_count_ & (std::uint64_t (1) << level)) != 0)
+          {
+            add (that.levels_ [level]);
+          }
+        }
+
+        add (that.block_sum_);
+      }
+
+
+      /**
+       * @brief
+       * @param that
+       * @return
+       */
+      constexpr self_type &
+      operator = (const self_type & that [[maybe_unused]]) noexcept = default;
+
+      /**
+       * @brief
+       * @param that
+       * @return
+       */
+      constexpr self_type &
+      operator = (self_type && that [[maybe_unused]]) noexcept = default;
+
+
+      /**
+       * @brief
+       * @param new_initial_value
+       * @return
+       */
+      constexpr self_type &
+      operator = (term_type new_initial_value) noexcept
+      {
+        block_sum_ = new_initial_value;
+        block_size_ = 0;
+        blocks_count_ = 0;
+
+        return * this;
+      }
+
+
+    private:
+      /**
+       * @brief Carries  `partial_sum'  of the whole block up through the occupied levels.
+       * @param partial_sum
+       */
+      constexpr void
+      push_ (term_type partial_sum) noexcept
+      {
+        std::size_t level (0);
+        while ((blocks_count_ & (std::uint64_t (1) << level)) != 0)
+        {
+          partial_sum = levels_ [level] + partial_sum;
+          ++ level;
+        }
+
+        levels_ [level] = partial_sum;
+        ++ blocks_count_;
+      }
+
+
+      /**
+       * @brief
+       */
+      static constexpr std::size_t block_capacity_ { Config::Utils::Summator::Pairwise_block_size };
+
+      /**
+       * @brief
+       */
+      static constexpr std::size_t levels_count_ { std::numeric_limits <std::uint64_t>::digits };
+
+      /**
+       * @brief Sum of the current incomplete block.
+       */
+      term_type block_sum_ { };
+
+      /**
+       * @brief
+       */
+      std::size_t block_size_ { };
+
+      /**
+       * @brief Number of complete blocks seen so far;  bit  `i'  is set iff  `levels_ [i]'  is occupied.
+       */
+      std::uint64_t blocks_count_ { };
+
+      /**
+       * @brief
+       */
+      term_type levels_ [levels_count_] { };
+
+      /**
+       * @brief
+       */
+      static constexpr term_type term_zero_ { };
+  };
+
+
   /**
    * @brief
    * @tparam TTerm
@@ -439,6 +1027,68 @@ namespace Utils
       }
 
 
+      /**
+       * @brief
+       * @tparam TInputIterator
+       * @param first
+       * @param last
+       * @return
+       */
+      template <typename TInputIterator>
+      constexpr self_type &
+      add (TInputIterator first, TInputIterator last) noexcept
+      {
+        using iterator_category = typename std::iterator_traits <TInputIterator>::iterator_category;
+
+
+        if constexpr (std::is_base_of_v <std::random_access_iterator_tag, iterator_category>)
+        {
+          summation_policy_.add (first, std::size_t (last - first));
+        }
+        else
+        {
+          while (first != last)
+          {
+            summation_policy_.add (term_type (* first));
+
+            ++ first;
+          }
+        }
+
+        return * this;
+      }
+
+
+      /**
+       * @brief
+       * @param terms
+       * @param count
+       * @return
+       */
+      constexpr self_type &
+      add (const term_type * terms, std::size_t count) noexcept
+      {
+        summation_policy_.add (terms, count);
+
+        return * this;
+      }
+
+
+      /**
+       * @brief Adds partial sum accumulated by  `that'.
+       * Merging the same partial sums in the same order always gives the same result.
+       * @param that
+       * @return
+       */
+      constexpr self_type &
+      merge (const self_type & that) noexcept
+      {
+        summation_policy_.merge (that.summation_policy_);
+
+        return * this;
+      }
+
+
       /**
        * @brief
        * @param output
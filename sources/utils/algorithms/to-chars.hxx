@@ -0,0 +1,96 @@
+#ifndef UTILS_ALGORITHMS_TOCHARS_HXX
+#define UTILS_ALGORITHMS_TOCHARS_HXX
+
+
+#include <cstddef>  // std::size_t
+#include <cstdint>  // std::uint64_t
+
+
+namespace Utils
+{
+  namespace ToCharsInternals_
+  {
+    /**
+     * @brief Decimal representations of  `00'  to  `99',  so two digits are produced per division.
+     */
+    struct DigitPairs_ final
+    {
+      /**
+       * @brief
+       */
+      constexpr DigitPairs_ () noexcept
+      {
+        for (std::size_t pair (0); pair < 100; ++ pair)
+        {
+          data [2 * pair] = char ('0' + pair / 10);
+          data [2 * pair + 1] = char ('0' + pair % 10);
+        }
+      }
+
+
+      /**
+       * @brief
+       */
+      char data [200] { };
+    };
+
+
+    /**
+     * @brief
+     */
+    inline constexpr DigitPairs_ Digit_pairs_ { };
+  }
+
+
+  /**
+   * @brief Writes exactly  `width'  decimal digits of  `value'  to  `first',  padding with zeros on the left  (higher
+   *   digits that don't fit are dropped).
+   * @param first
+   * @param value
+   * @param width
+   * @return Pointer past the last written character.
+   */
+  constexpr char *
+  toCharsFixed (char * first, std::uint64_t value, std::size_t width) noexcept
+  {
+    char * last (first + width);
+    char * position (last);
+    while (position - first >= 2)
+    {
+      const std::size_t pair (std::size_t (value % 100));
+      value /= 100;
+      position -= 2;
+      position [0] = ToCharsInternals_::Digit_pairs_.data [2 * pair];
+      position [1] = ToCharsInternals_::Digit_pairs_.data [2 * pair + 1];
+    }
+
+    if (position != first)
+    {
+      * first = char ('0' + value % 10);
+    }
+
+    return last;
+  }
+
+
+  /**
+   * @brief Writes the shortest decimal representation of  `value'  to  `first'  (at most 20 characters).
+   * @param first
+   * @param value
+   * @return Pointer past the last written character.
+   */
+  constexpr char *
+  toChars (char * first, std::uint64_t value) noexcept
+  {
+    std::size_t width (1);
+    for (std::uint64_t rest (value / 10); rest != 0; rest /= 10)
+    {
+      ++ width;
+    }
+
+    return toCharsFixed (first, value, width);
+  }
+}
+
+
+#endif  // UTILS_ALGORITHMS_TOCHARS_HXX
@@ -0,0 +1,832 @@
+#include "benchmark.hxx"  // Benchmark::*,  BenchmarkResult
+
+#include <cmath>  // std::isnan
+#include <cstddef>  // std::{ptrdiff_t, size_t}
+#include <cstdint>  // std::{uint64_t, uint8_t}
+#include <cstdlib>  // std::strtod
+
+#include <algorithm>  // std::{find_if, max, min, nth_element, sort}
+#include <chrono>  // std::chrono::{duration, duration_cast, nanoseconds, steady_clock}
+#include <fstream>  // std::{ifstream, ofstream}
+#include <iostream>  // std::{cerr, clog}
+#include <iterator>  // std::istreambuf_iterator
+#include <limits>  // std::numeric_limits
+#include <memory>  // std::{make_shared, shared_ptr}
+#include <stdexcept>  // std::runtime_error
+#include <string>  // std::{stod, stoi, string}
+#include <utility>  // std::{move, pair}
+
+#ifdef __linux__
+#include <sched.h>  // CPU_{SET, ZERO},  ::{cpu_set_t, sched_setaffinity}
+#endif  // __linux__
+
+#include <fmt/format.h>  // fmt::format
+#include <fmt/ostream.h>  // fmt::print[std::ostream]
+
+#include "../algorithms/running-stats.hxx"  // RunningStats
+#include "../config/benchmark.hxx"  // Config::Utils::Benchmark::*
+#include "perf-counters.hxx"  // PerfCounter,  PerfCounters
+
+
+namespace Utils
+{
+  namespace
+  {
+    /**
+     * @brief
+     */
+    using clock_type = std::chrono::steady_clock;
+
+    /**
+     * @brief
+     */
+    struct Case final
+    {
+      /**
+       * @brief
+       */
+      std::string name;
+
+      /**
+       * @brief
+       */
+      Benchmark::function_type function;
+
+      /**
+       * @brief Per-iteration latencies of the last run,  `nullptr'  unless added with  `Benchmark::add_Latency'.
+       */
+      std::shared_ptr <std::vector <double>> latencies;
+    };
+
+
+    /**
+     * @brief JSON keys of the floating point fields of  `BenchmarkResult'.
+     */
+    const std::pair <const char *, double BenchmarkResult::*> Number_fields [] {
+      { "min_ns", & BenchmarkResult::minimum },
+      { "median_ns", & BenchmarkResult::median },
+      { "mean_ns", & BenchmarkResult::mean },
+      { "stddev_ns", & BenchmarkResult::standard_deviation },
+      { "cycles", & BenchmarkResult::cycles },
+      { "instructions", & BenchmarkResult::instructions },
+      { "cache_misses", & BenchmarkResult::cache_misses },
+      { "branch_misses", & BenchmarkResult::branch_misses },
+      { "p50_ns", & BenchmarkResult::latency_p50 },
+      { "p99_ns", & BenchmarkResult::latency_p99 },
+    };
+
+
+    /**
+     * @brief
+     * @return
+     */
+    std::vector <Case> &
+    cases ()
+    {
+      static std::vector <Case> registered_cases;
+
+      return registered_cases;
+    }
+
+
+    /**
+     * @brief
+     * @param function
+     * @param iterations
+     * @return
+     */
+    double
+    timeIterations (const Benchmark::function_type & function, std::size_t iterations)
+    {
+      const clock_type::time_point time_started (clock_type::now ());
+      function (iterations);
+      const clock_type::time_point time_stopped (clock_type::now ());
+
+      return double (std::chrono::duration_cast <std::chrono::nanoseconds> (time_stopped - time_started).count ());
+    }
+
+
+    /**
+     * @brief Grows the iterations count until a run lasts at least  `Trial_time'.
+     * @param function
+     * @return
+     */
+    std::size_t
+    calibrate (const Benchmark::function_type & function)
+    {
+      const double trial_time (
+        double (std::chrono::duration_cast <std::chrono::nanoseconds> (Config::Utils::Benchmark::Trial_time).count ())
+      );
+
+      std::size_t iterations (1);
+      while (true)
+      {
+        const double elapsed (timeIterations (function, iterations));
+        if (! (elapsed < trial_time))
+        {
+          return iterations;
+        }
+
+        // Aim  20%  past the target,  but grow at most tenfold per step since short runs are noisy.
+        const double factor ((elapsed > 0) ? (1.2 * trial_time / elapsed) : 10.0);
+        iterations = std::size_t (double (iterations) * std::min (std::max (factor, 2.0), 10.0));
+      }
+    }
+
+
+    /**
+     * @brief
+     * @param values
+     * @param fraction
+     * @return Value below which  `fraction'  of  `values'  lie;  reorders  `values'.
+     */
+    double
+    percentile (std::vector <double> & values, double fraction)
+    {
+      const std::vector <double>::iterator nth (
+        values.begin () + std::ptrdiff_t (fraction * double (values.size () - 1) + 0.5)
+      );
+      std::nth_element (values.begin (), nth, values.end ());
+
+      return * nth;
+    }
+
+
+    /**
+     * @brief
+     * @param values
+     * @return
+     */
+    double
+    median (std::vector <double> values)
+    {
+      std::sort (values.begin (), values.end ());
+      const std::size_t middle (values.size () / 2);
+
+      return (values.size () % 2 != 0) ? values [middle] : ((values [middle - 1] + values [middle]) / 2);
+    }
+
+
+    /**
+     * @brief
+     * @param value
+     * @param iterations
+     * @return
+     */
+    double
+    perIteration (std::uint64_t value, std::size_t iterations) noexcept
+    {
+      return double (value) / double (iterations);
+    }
+
+
+    /**
+     * @brief
+     * @param registered_case
+     * @return
+     */
+    BenchmarkResult
+    runCase (const Case & registered_case)
+    {
+      const Benchmark::function_type & function (registered_case.function);
+
+      const clock_type::time_point warmup_stopped (clock_type::now () + Config::Utils::Benchmark::Warmup_time);
+      std::size_t iterations (calibrate (function));
+      while (clock_type::now () < warmup_stopped)
+      {
+        function (iterations);
+      }
+
+      PerfCounters counters;
+      PerfCounters::values_type counter_totals { };
+      RunningStats <double> statistics;
+      std::vector <double> times;
+      times.reserve (Config::Utils::Benchmark::Trials);
+      std::vector <double> p50s;
+      std::vector <double> p99s;
+
+      for (std::size_t trial (0); trial < Config::Utils::Benchmark::Trials; ++ trial)
+      {
+        counters.start ();
+        const double elapsed (timeIterations (function, iterations));
+        counters.stop ();
+
+        const PerfCounters::values_type values (counters.read ());
+        for (std::size_t index (0); index < PerfCounters::counters_count; ++ index)
+        {
+          counter_totals [index] += values [index];
+        }
+
+        const double time (elapsed / double (iterations));
+        statistics.push (time);
+        times.push_back (time);
+
+        if (registered_case.latencies != nullptr)
+        {
+          std::vector <double> & latencies (* registered_case.latencies);
+          latencies.resize (iterations);
+          p50s.push_back (percentile (latencies, 0.50));
+          p99s.push_back (percentile (latencies, 0.99));
+        }
+      }
+
+      const std::size_t total_iterations (iterations * Config::Utils::Benchmark::Trials);
+      const auto counter (
+        [& counters, & counter_totals, total_iterations] (PerfCounter which)
+        {
+          return counters.isAvailable (which)
+            ? perIteration (counter_totals [std::size_t (which)], total_iterations)
+            : std::numeric_limits <double>::quiet_NaN ();
+        }
+      );
+
+      const double nan (std::numeric_limits <double>::quiet_NaN ());
+
+      return {
+        registered_case.name, iterations, Config::Utils::Benchmark::Trials,
+        statistics.minimum (), median (times), statistics.mean (), statistics.standardDeviation (),
+        counter (PerfCounter::Cycles), counter (PerfCounter::Instructions),
+        counter (PerfCounter::CacheMisses), counter (PerfCounter::BranchMisses),
+        (p50s.empty ()) ? nan : median (p50s), (p99s.empty ()) ? nan : median (p99s)
+      };
+    }
+
+
+    /**
+     * @brief
+     * @param output
+     * @param string
+     */
+    void
+    writeJsonString (std::ostream & output, const std::string & string)
+    {
+      output << '"';
+      for (const char character : string)
+      {
+        if ((character == '"') || (character == '\\'))
+        {
+          output << '\\' << character;
+        }
+        else if (std::uint8_t (character) < 0x20)
+        {
+          fmt::print (output, "\\u{0:04x}", unsigned (character));
+        }
+        else
+        {
+          output << character;
+        }
+      }
+
+      output << '"';
+    }
+
+
+    /**
+     * @brief
+     * @param output
+     * @param value
+     */
+    void
+    writeJsonNumber (std::ostream & output, double value)
+    {
+      if (std::isnan (value))
+      {
+        output << "null";
+      }
+      else
+      {
+        fmt::print (output, "{0:.6g}", value);
+      }
+    }
+
+
+    /**
+     * @brief Reader for the flat JSON written by  `Benchmark::writeJson':  objects of strings,  numbers  &  nulls
+     *   inside one array.
+     */
+    class JsonReader final
+    {
+      public:
+        /**
+         * @brief
+         * @param text
+         */
+        explicit JsonReader (std::string text) :
+          text_ (std::move (text))
+        { }
+
+
+        /**
+         * @brief
+         * @return
+         */
+        std::vector <BenchmarkResult>
+        read ()
+        {
+          std::vector <BenchmarkResult> results;
+
+          position_ = text_.find ('[');
+          if (position_ == std::string::npos)
+          {
+            fail ("expected  `['");
+          }
+
+          ++ position_;
+          if (peek () == ']')
+          {
+            return results;
+          }
+
+          while (true)
+          {
+            results.push_back (readResult ());
+
+            const char separator (next ());
+            if (separator == ']')
+            {
+              return results;
+            }
+
+            if (separator != ',')
+            {
+              fail ("expected  `,'  or  `]'");
+            }
+          }
+        }
+
+
+      private:
+        /**
+         * @brief
+         * @param message
+         */
+        [[noreturn]] void
+        fail (const char * message) const
+        {
+          throw std::runtime_error (fmt::format ("Benchmark JSON:  {0:s}  at offset  {1:d}", message, position_));
+        }
+
+
+        /**
+         * @brief Skips whitespace.
+         * @return Next character,  not consumed.
+         */
+        char
+        peek ()
+        {
+          while ((position_ < text_.size ()) && (std::uint8_t (text_ [position_]) <= ' '))
+          {
+            ++ position_;
+          }
+
+          if (! (position_ < text_.size ()))
+          {
+            fail ("unexpected end");
+          }
+
+          return text_ [position_];
+        }
+
+
+        /**
+         * @brief
+         * @return
+         */
+        char
+        next ()
+        {
+          const char character (peek ());
+          ++ position_;
+
+          return character;
+        }
+
+
+        /**
+         * @brief
+         * @return
+         */
+        std::string
+        readString ()
+        {
+          if (next () != '"')
+          {
+            fail ("expected a string");
+          }
+
+          std::string string;
+          while (true)
+          {
+            if (! (position_ < text_.size ()))
+            {
+              fail ("unterminated string");
+            }
+
+            const char character (text_ [position_]);
+            ++ position_;
+            if (character == '"')
+            {
+              return string;
+            }
+
+            if (character == '\\')
+            {
+              if (! (position_ < text_.size ()))
+              {
+                fail ("unterminated string");
+              }
+
+              const char escaped (text_ [position_]);
+              ++ position_;
+              if (escaped == 'u')
+              {
+                string += char (std::stoi (text_.substr (position_, 4), nullptr, 16));
+                position_ += 4;
+              }
+              else
+              {
+                string += escaped;
+              }
+            }
+            else
+            {
+              string += character;
+            }
+          }
+        }
+
+
+        /**
+         * @brief
+         * @return Number,  or NaN for  `null'.
+         */
+        double
+        readNumber ()
+        {
+          peek ();
+          if (text_.compare (position_, 4, "null") == 0)
+          {
+            position_ += 4;
+
+            return std::numeric_limits <double>::quiet_NaN ();
+          }
+
+          const char * const first (text_.c_str () + position_);
+          char * last (nullptr);
+          const double number (std::strtod (first, & last));
+          if (last == first)
+          {
+            fail ("expected a number");
+          }
+
+          position_ += std::size_t (last - first);
+
+          return number;
+        }
+
+
+        /**
+         * @brief
+         * @return
+         */
+        BenchmarkResult
+        readResult ()
+        {
+          const double nan (std::numeric_limits <double>::quiet_NaN ());
+          BenchmarkResult result { { }, 0, 0, nan, nan, nan, nan, nan, nan, nan, nan, nan, nan };
+
+          if (next () != '{')
+          {
+            fail ("expected  `{'");
+          }
+
+          if (peek () == '}')
+          {
+            ++ position_;
+
+            return result;
+          }
+
+          while (true)
+          {
+            const std::string key (readString ());
+            if (next () != ':')
+            {
+              fail ("expected  `:'");
+            }
+
+            if (key == "name")
+            {
+              result.name = readString ();
+            }
+            else
+            {
+              const double value (readNumber ());
+              if (key == "iterations")
+              {
+                result.iterations = std::size_t (value);
+              }
+              else if (key == "trials")
+              {
+                result.trials = std::size_t (value);
+              }
+              else
+              {
+                for (const std::pair <const char *, double BenchmarkResult::*> & field : Number_fields)
+                {
+                  if (key == field.first)
+                  {
+                    result.* field.second = value;
+                  }
+                }
+              }
+            }
+
+            const char separator (next ());
+            if (separator == '}')
+            {
+              return result;
+            }
+
+            if (separator != ',')
+            {
+              fail ("expected  `,'  or  `}'");
+            }
+          }
+        }
+
+
+        /**
+         * @brief
+         */
+        const std::string text_;
+
+        /**
+         * @brief
+         */
+        std::size_t position_ { };
+    };
+
+
+    /**
+     * @brief
+     * @param argument
+     * @param option
+     * @param value Receives the text after  `option'.
+     * @return Whether  `argument'  starts with  `option'.
+     */
+    bool
+    parseOption (const std::string & argument, const std::string & option, std::string & value)
+    {
+      if (argument.compare (0, option.size (), option) != 0)
+      {
+        return false;
+      }
+
+      value = argument.substr (option.size ());
+
+      return true;
+    }
+  }
+
+
+  void
+  Benchmark::add (const std::string & name, function_type function)
+  {
+    cases ().push_back ({ name, std::move (function), nullptr });
+  }
+
+
+  void
+  Benchmark::add_Latency (const std::string & name, latency_function_type function)
+  {
+    const std::shared_ptr <std::vector <double>> latencies (std::make_shared <std::vector <double>> ());
+    cases ().push_back (
+      {
+        name,
+        [function = std::move (function), latencies] (std::size_t iterations)
+        {
+          // Only grows while calibrating,  i. e. before the measured trials.
+          if (latencies->size () < iterations)
+          {
+            latencies->resize (iterations);
+          }
+
+          function (iterations, latencies->data ());
+        },
+        latencies
+      }
+    );
+  }
+
+
+  std::vector <BenchmarkResult>
+  Benchmark::run (const std::string & filter, std::ostream * log)
+  {
+    std::vector <BenchmarkResult> results;
+    for (const Case & registered_case : cases ())
+    {
+      if (registered_case.name.find (filter) == std::string::npos)
+      {
+        continue;
+      }
+
+      results.push_back (runCase (registered_case));
+
+      if (log != nullptr)
+      {
+        const BenchmarkResult & result (results.back ());
+        fmt::print (
+          * log, "{0:<48s} {1:>12.2f} ns  (min  {2:.2f},  sd  {3:.2f},  {4:d} x {5:d})",
+          result.name, result.median, result.minimum, result.standard_deviation, result.trials, result.iterations
+        );
+        if (! std::isnan (result.latency_p50))
+        {
+          fmt::print (* log, "  p50  {0:.2f},  p99  {1:.2f} ns", result.latency_p50, result.latency_p99);
+        }
+
+        * log << '\n';
+      }
+    }
+
+    return results;
+  }
+
+
+  bool
+  Benchmark::pinThread (int cpu) noexcept
+  {
+#ifdef __linux__
+    if (cpu < 0)
+    {
+      return false;
+    }
+
+    ::cpu_set_t cpus;
+    CPU_ZERO (& cpus);
+    CPU_SET (std::size_t (cpu), & cpus);
+
+    return ::sched_setaffinity (0, sizeof (cpus), & cpus) == 0;
+#else  // __linux__
+    return false;
+#endif  // __linux__
+  }
+
+
+  void
+  Benchmark::writeJson (std::ostream & output, const std::vector <BenchmarkResult> & results)
+  {
+    output << "{\"benchmarks\": [";
+
+    bool is_first (true);
+    for (const BenchmarkResult & result : results)
+    {
+      output << ((is_first) ? "\n  {\"name\": " : ",\n  {\"name\": ");
+      writeJsonString (output, result.name);
+      fmt::print (output, ", \"iterations\": {0:d}, \"trials\": {1:d}", result.iterations, result.trials);
+
+      for (const std::pair <const char *, double BenchmarkResult::*> & field : Number_fields)
+      {
+        fmt::print (output, ", \"{0:s}\": ", field.first);
+        writeJsonNumber (output, result.* field.second);
+      }
+
+      output << '}';
+      is_first = false;
+    }
+
+    output << "\n]}\n";
+  }
+
+
+  std::vector <BenchmarkResult>
+  Benchmark::readJson (std::istream & input)
+  {
+    std::string text ((std::istreambuf_iterator <char> (input)), std::istreambuf_iterator <char> ());
+
+    return JsonReader (std::move (text)).read ();
+  }
+
+
+  std::size_t
+  Benchmark::compare (
+    const std::vector <BenchmarkResult> & baseline, const std::vector <BenchmarkResult> & current,
+    double threshold, std::ostream & report
+  )
+  {
+    std::size_t regressions_count (0);
+    for (const BenchmarkResult & result : current)
+    {
+      const auto found (
+        std::find_if (
+          baseline.cbegin (), baseline.cend (),
+          [& result] (const BenchmarkResult & that)
+          {
+            return that.name == result.name;
+          }
+        )
+      );
+      if (found == baseline.cend ())
+      {
+        continue;
+      }
+
+      const double change (result.median / found->median - 1);
+      const bool is_regression (change > threshold);
+      if (is_regression)
+      {
+        ++ regressions_count;
+      }
+
+      fmt::print (
+        report, "{0:<48s} {1:>12.2f} -> {2:>12.2f} ns  {3:>+7.1f}%{4:s}\n",
+        result.name, found->median, result.median, 100 * change, (is_regression) ? "  REGRESSION" : ""
+      );
+    }
+
+    return regressions_count;
+  }
+
+
+  int
+  Benchmark::main (int argc, const char * const * argv)
+  {
+    std::string filter;
+    std::string json_path;
+    std::string baseline_path;
+    double threshold (Config::Utils::Benchmark::Regression_threshold);
+
+    try
+    {
+      for (int index (1); index < argc; ++ index)
+      {
+        const std::string argument (argv [index]);
+        std::string value;
+        if (parseOption (argument, "--filter=", value))
+        {
+          filter = value;
+        }
+        else if (parseOption (argument, "--cpu=", value))
+        {
+          if (! pinThread (std::stoi (value)))
+          {
+            fmt::print (std::cerr, "Couldn't pin to CPU  {0:s}\n", value);
+          }
+        }
+        else if (parseOption (argument, "--json=", value))
+        {
+          json_path = value;
+        }
+        else if (parseOption (argument, "--baseline=", value))
+        {
+          baseline_path = value;
+        }
+        else if (parseOption (argument, "--threshold=", value))
+        {
+          threshold = std::stod (value);
+        }
+        else
+        {
+          fmt::print (std::cerr, "Unknown argument  `{0:s}'\n", argument);
+
+          return 1;
+        }
+      }
+
+      const std::vector <BenchmarkResult> results (run (filter, & std::clog));
+
+      if (! json_path.empty ())
+      {
+        std::ofstream json_output (json_path);
+        writeJson (json_output, results);
+      }
+
+      if (! baseline_path.empty ())
+      {
+        std::ifstream baseline_input (baseline_path);
+        if (! baseline_input)
+        {
+          fmt::print (std::cerr, "Couldn't open  `{0:s}'\n", baseline_path);
+
+          return 1;
+        }
+
+        const std::size_t regressions_count (compare (readJson (baseline_input), results, threshold, std::clog));
+        if (regressions_count > 0)
+        {
+          fmt::print (std::clog, "{0:d}  regression(s)  beyond  {1:.1f}%\n", regressions_count, 100 * threshold);
+
+          return 1;
+        }
+      }
+    }
+    catch (const std::exception & exception)
+    {
+      fmt::print (std::cerr, "{0:s}\n", exception.what ());
+
+      return 1;
+    }
+
+    return 0;
+  }
+}
@@ -0,0 +1,259 @@
+#ifndef UTILS_BENCHMARK_BENCHMARK_HXX
+#define UTILS_BENCHMARK_BENCHMARK_HXX
+
+
+#include <cstddef>  // std::size_t
+
+#include <functional>  // std::function
+#include <istream>  // std::istream
+#include <ostream>  // std::ostream
+#include <string>  // std::string
+#include <vector>  // std::vector
+
+
+namespace Utils
+{
+  /**
+   * @brief Keeps the compiler from optimizing away the computation of  `value'.
+   * @tparam TValue
+   * @param value
+   */
+  template <typename TValue>
+  inline void
+  doNotOptimize (const TValue & value) noexcept
+  {
+    asm volatile ("" : : "r,m" (value) : "memory");
+  }
+
+
+  /**
+   * @brief Keeps the compiler from eliding or reordering memory writes across the call.
+   */
+  inline void
+  clobberMemory () noexcept
+  {
+    asm volatile ("" : : : "memory");
+  }
+
+
+  /**
+   * @brief Measurements of one benchmark case.
+   * Times are in nanoseconds per iteration;  counters are per iteration  &  NaN if unavailable.  Latency
+   *   percentiles are medians over trials,  NaN unless the case is added with  `Benchmark::add_Latency'.
+   */
+  struct BenchmarkResult final
+  {
+    /**
+     * @brief
+     */
+    std::string name;
+
+    /**
+     * @brief Iterations per trial.
+     */
+    std::size_t iterations;
+
+    /**
+     * @brief
+     */
+    std::size_t trials;
+
+    /**
+     * @brief
+     */
+    double minimum;
+
+    /**
+     * @brief
+     */
+    double median;
+
+    /**
+     * @brief
+     */
+    double mean;
+
+    /**
+     * @brief
+     */
+    double standard_deviation;
+
+    /**
+     * @brief
+     */
+    double cycles;
+
+    /**
+     * @brief
+     */
+    double instructions;
+
+    /**
+     * @brief
+     */
+    double cache_misses;
+
+    /**
+     * @brief
+     */
+    double branch_misses;
+
+    /**
+     * @brief
+     */
+    double latency_p50;
+
+    /**
+     * @brief
+     */
+    double latency_p99;
+  };
+
+
+  /**
+   * @brief Registry  &  runner of micro-benchmarks.
+   * A case is a function that runs its body the given number of times.  Each case is warmed up for
+   *   `Warmup_time',  calibrated so a trial lasts at least  `Trial_time'  &  measured over  `Trials'  trials,
+   *   with hardware counters where  `PerfCounters'  can read them.
+   */
+  class Benchmark final
+  {
+    public:
+      /**
+       * @brief
+       */
+      using function_type = std::function <void (std::size_t)>;
+
+      /**
+       * @brief Runs its body the given number of times  &  writes the duration of each run,  in nanoseconds,  to
+       *   the given array.
+       */
+      using latency_function_type = std::function <void (std::size_t, double *)>;
+
+
+    private:
+      /**
+       * @brief
+       */
+      using self_type = Benchmark;
+
+
+    public:
+      /**
+       * @brief
+       */
+      Benchmark () noexcept = delete;
+
+      /**
+       * @brief
+       * @param that
+       */
+      Benchmark (const self_type & that [[maybe_unused]]) noexcept = delete;
+
+      /**
+       * @brief
+       * @param that
+       */
+      Benchmark (self_type && that [[maybe_unused]]) noexcept = delete;
+
+
+      /**
+       * @brief
+       * @param name
+       * @param function
+       */
+      static void
+      add (const std::string & name, function_type function);
+
+      /**
+       * @brief Same as  `add',  the case also reports the  50th  &  99th  percentiles of the per-iteration latency.
+       * @param name
+       * @param function
+       */
+      static void
+      add_Latency (const std::string & name, latency_function_type function);
+
+
+      /**
+       * @brief Runs the registered cases whose names contain  `filter'.
+       * @param filter
+       * @param log Receives a line per finished case;  may be  `nullptr'.
+       * @return
+       */
+      [[nodiscard]] static std::vector <BenchmarkResult>
+      run (const std::string & filter, std::ostream * log);
+
+
+      /**
+       * @brief Pins the calling thread to the given CPU.
+       * @param cpu
+       * @return Whether the thread was pinned.
+       */
+      static bool
+      pinThread (int cpu) noexcept;
+
+
+      /**
+       * @brief
+       * @param output
+       * @param results
+       */
+      static void
+      writeJson (std::ostream & output, const std::vector <BenchmarkResult> & results);
+
+
+      /**
+       * @brief Reads results written by  `writeJson'.
+       * @param input
+       * @return
+       * @throws std::runtime_error
+       */
+      [[nodiscard]] static std::vector <BenchmarkResult>
+      readJson (std::istream & input);
+
+
+      /**
+       * @brief Compares median times of the cases present in both result sets.
+       * @param baseline
+       * @param current
+       * @param threshold
+       * @param report Receives a line per compared case.
+       * @return Number of cases slower than the baseline by more than  `threshold'.
+       */
+      static std::size_t
+      compare (
+        const std::vector <BenchmarkResult> & baseline, const std::vector <BenchmarkResult> & current,
+        double threshold, std::ostream & report
+      );
+
+
+      /**
+       * @brief Command line driver:  `[--filter=TEXT] [--cpu=N] [--json=PATH] [--baseline=PATH] [--threshold=X]'.
+       * @param argc
+       * @param argv
+       * @return  `0',  or  `1'  if there were regressions or errors.
+       */
+      static int
+      main (int argc, const char * const * argv);
+
+
+      /**
+       * @brief
+       * @param that
+       * @return
+       */
+      self_type &
+      operator = (const self_type & that [[maybe_unused]]) noexcept = delete;
+
+      /**
+       * @brief
+       * @param that
+       * @return
+       */
+      self_type &
+      operator = (self_type && that [[maybe_unused]]) noexcept = delete;
+  };
+}
+
+
+#endif  // UTILS_BENCHMARK_BENCHMARK_HXX
@@ -0,0 +1,11 @@
+#include "benchmark.hxx"  // Benchmark::main
+#include "utility-cases.hxx"  // registerUtilityBenchmarks
+
+
+int
+main (int argc, char ** argv)
+{
+  Utils::registerUtilityBenchmarks ();
+
+  return Utils::Benchmark::main (argc, argv);
+}
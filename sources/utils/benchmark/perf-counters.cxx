@@ -0,0 +1,148 @@
+#include "perf-counters.hxx"  // PerfCounter,  PerfCounters::*
+
+#include <cstddef>  // std::size_t
+#include <cstdint>  // std::uint64_t
+
+#ifdef __linux__
+#include <linux/perf_event.h>  // PERF_*,  ::perf_event_attr
+#include <sys/ioctl.h>  // ::ioctl
+#include <sys/syscall.h>  // SYS_perf_event_open
+#include <unistd.h>  // ::{close, read, syscall}
+#endif  // __linux__
+
+
+namespace Utils
+{
+#ifdef __linux__
+  namespace
+  {
+    /**
+     * @brief Event configurations in  `PerfCounter'  order.
+     */
+    constexpr std::uint64_t Event_configs [PerfCounters::counters_count] {
+      PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES
+    };
+
+
+    /**
+     * @brief
+     * @param config
+     * @return File descriptor,  or  `- 1'.
+     */
+    int
+    openCounter (std::uint64_t config) noexcept
+    {
+      ::perf_event_attr attributes { };
+      attributes.type = PERF_TYPE_HARDWARE;
+      attributes.size = sizeof (attributes);
+      attributes.config = config;
+      attributes.disabled = 1;
+      attributes.exclude_kernel = 1;
+      attributes.exclude_hv = 1;
+
+      return int (::syscall (SYS_perf_event_open, & attributes, 0, - 1, - 1, 0));
+    }
+  }
+
+
+  PerfCounters::PerfCounters () noexcept
+  {
+    for (std::size_t index (0); index < counters_count; ++ index)
+    {
+      file_descriptors_ [index] = openCounter (Event_configs [index]);
+    }
+  }
+
+
+  PerfCounters::~ PerfCounters ()
+  {
+    for (const int file_descriptor : file_descriptors_)
+    {
+      if (file_descriptor >= 0)
+      {
+        ::close (file_descriptor);
+      }
+    }
+  }
+
+
+  void
+  PerfCounters::start () noexcept
+  {
+    for (const int file_descriptor : file_descriptors_)
+    {
+      if (file_descriptor >= 0)
+      {
+        ::ioctl (file_descriptor, PERF_EVENT_IOC_RESET, 0);
+        ::ioctl (file_descriptor, PERF_EVENT_IOC_ENABLE, 0);
+      }
+    }
+  }
+
+
+  void
+  PerfCounters::stop () noexcept
+  {
+    for (const int file_descriptor : file_descriptors_)
+    {
+      if (file_descriptor >= 0)
+      {
+        ::ioctl (file_descriptor, PERF_EVENT_IOC_DISABLE, 0);
+      }
+    }
+  }
+
+
+  PerfCounters::values_type
+  PerfCounters::read () const noexcept
+  {
+    values_type values { };
+    for (std::size_t index (0); index < counters_count; ++ index)
+    {
+      if (file_descriptors_ [index] >= 0)
+      {
+        std::uint64_t value (0);
+        if (::read (file_descriptors_ [index], & value, sizeof (value)) == ::ssize_t (sizeof (value)))
+        {
+          values [index] = value;
+        }
+      }
+    }
+
+    return values;
+  }
+#else  // __linux__
+  PerfCounters::PerfCounters () noexcept
+  {
+    file_descriptors_.fill (- 1);
+  }
+
+
+  PerfCounters::~ PerfCounters ()
+  { }
+
+
+  void
+  PerfCounters::start () noexcept
+  { }
+
+
+  void
+  PerfCounters::stop () noexcept
+  { }
+
+
+  PerfCounters::values_type
+  PerfCounters::read () const noexcept
+  {
+    return { };
+  }
+#endif  // __linux__
+
+
+  bool
+  PerfCounters::isAvailable (PerfCounter counter) const noexcept
+  {
+    return file_descriptors_ [std::size_t (counter)] >= 0;
+  }
+}
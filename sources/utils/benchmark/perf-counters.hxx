@@ -0,0 +1,133 @@
+#ifndef UTILS_BENCHMARK_PERFCOUNTERS_HXX
+#define UTILS_BENCHMARK_PERFCOUNTERS_HXX
+
+
+#include <cstddef>  // std::size_t
+#include <cstdint>  // std::uint64_t
+
+#include <array>  // std::array
+
+
+namespace Utils
+{
+  /**
+   * @brief
+   */
+  enum struct PerfCounter : std::size_t
+  {
+    Cycles = 0,
+    Instructions = 1,
+    CacheMisses = 2,
+    BranchMisses = 3,
+  };
+
+
+  /**
+   * @brief Hardware counters of the calling thread read through  `perf_event_open'.
+   * Counters that can't be opened  (not Linux,  no PMU in a VM,  `perf_event_paranoid'  too strict,  ...)  are
+   *   reported as unavailable,  the rest keep working.
+   */
+  class PerfCounters final
+  {
+    public:
+      /**
+       * @brief
+       */
+      static constexpr std::size_t counters_count { 4 };
+
+      /**
+       * @brief
+       */
+      using values_type = std::array <std::uint64_t, counters_count>;
+
+
+    private:
+      /**
+       * @brief
+       */
+      using self_type = PerfCounters;
+
+
+    public:
+      /**
+       * @brief Opens the counters,  stopped.
+       */
+      PerfCounters () noexcept;
+
+      /**
+       * @brief
+       * @param that
+       */
+      PerfCounters (const self_type & that [[maybe_unused]]) noexcept = delete;
+
+      /**
+       * @brief
+       * @param that
+       */
+      PerfCounters (self_type && that [[maybe_unused]]) noexcept = delete;
+
+
+      /**
+       * @brief
+       */
+      ~ PerfCounters ();
+
+
+      /**
+       * @brief
+       * @param counter
+       * @return
+       */
+      [[nodiscard]] bool
+      isAvailable (PerfCounter counter) const noexcept;
+
+
+      /**
+       * @brief Resets  &  starts all the available counters.
+       */
+      void
+      start () noexcept;
+
+
+      /**
+       * @brief
+       */
+      void
+      stop () noexcept;
+
+
+      /**
+       * @brief
+       * @return Counts between the last  `start'  &  `stop';  zeros for unavailable counters.
+       */
+      [[nodiscard]] values_type
+      read () const noexcept;
+
+
+      /**
+       * @brief
+       * @param that
+       * @return
+       */
+      self_type &
+      operator = (const self_type & that [[maybe_unused]]) noexcept = delete;
+
+      /**
+       * @brief
+       * @param that
+       * @return
+       */
+      self_type &
+      operator = (self_type && that [[maybe_unused]]) noexcept = delete;
+
+
+    private:
+      /**
+       * @brief  `- 1'  for unavailable counters.
+       */
+      std::array <int, counters_count> file_descriptors_;
+  };
+}
+
+
+#endif  // UTILS_BENCHMARK_PERFCOUNTERS_HXX
@@ -0,0 +1,1108 @@
+#include "utility-cases.hxx"  // registerUtilityBenchmarks
+
+#include <cstddef>  // std::{byte, size_t}
+#include <cstdint>  // std::{int64_t, uint32_t, uint64_t}
+#include <cstdlib>  // std::{free, malloc}
+#include <ctime>  // std::time_t
+
+#include <chrono>  // std::chrono::{nanoseconds, system_clock}
+#include <iostream>  // std::clog
+#include <memory>  // std::{make_shared, shared_ptr}
+#include <mutex>  // std::{lock_guard, mutex}
+#include <random>  // std::{mt19937_64, uniform_real_distribution}
+#include <streambuf>  // std::streambuf
+#include <string>  // std::string
+#include <thread>  // std::thread
+#include <vector>  // std::vector
+
+#include <fcntl.h>  // O_WRONLY,  ::open
+#include <unistd.h>  // ::close
+
+#include <fmt/format.h>  // fmt::format
+
+#include "../algorithms/clz.hxx"  // clz
+#include "../algorithms/ctz.hxx"  // ctz,  CtzInternals_::ctzDeBruijn_
+#include "../algorithms/is-close.hxx"  // isClose
+#include "../algorithms/lerp-2d.hxx"  // lerp_2d
+#include "../algorithms/min.hxx"  // min
+#include "../algorithms/popcount.hxx"  // popcount,  PopcountInternals_::popcountSwar_
+#include "../algorithms/rationalize.hxx"  // rationalize
+#include "../algorithms/summator.hxx"  // *SummationPolicy,  Summator
+#include "../config/pool.hxx"  // Config::Utils::Pool::Magazine_capacity
+#include "../containers/bitmap.hxx"  // Bitmap
+#include "../containers/c-string.hxx"  // CString
+#include "../containers/grid-2d.hxx"  // Grid2d
+#include "../date-time/format-date-iso8601.hxx"  // Date_Iso8601_max_size,  formatDate_Iso8601
+#include "../date-time/format-duration.hxx"  // Duration_max_size,  formatDuration
+#include "../date-time/timer.hxx"  // Timer
+#include "../date-time/tsc-clock.hxx"  // TscClock
+#include "../logging/async-logger.hxx"  // AsyncLogger,  AsyncLogOverflowPolicy
+#include "../logging/logger.hxx"  // Logger
+#include "../memory/arena.hxx"  // Arena
+#include "../memory/pool.hxx"  // Pool
+#include "../misc/expected.hxx"  // CheckedNoDiscardPolicy,  Expected,  UncheckedPolicy,  Unexpected
+#include "benchmark.hxx"  // Benchmark,  clobberMemory,  doNotOptimize
+
+
+namespace Utils
+{
+  namespace
+  {
+    /**
+     * @brief
+     */
+    constexpr std::size_t Sizes [] { 1 << 10, 1 << 16, 1 << 20 };
+
+    /**
+     * @brief Number of pre-generated inputs of the per-call cases,  a power of 2.
+     */
+    constexpr std::size_t Inputs_count (1 << 12);
+
+    /**
+     * @brief
+     */
+    constexpr std::uint64_t Seed (0x5eed);
+
+
+    /**
+     * @brief Discards everything written to it.
+     */
+    class NullBuffer final :
+      public std::streambuf
+    {
+      protected:
+        /**
+         * @brief
+         * @param character
+         * @return
+         */
+        int_type
+        overflow (int_type character) override
+        {
+          return character;
+        }
+    };
+
+
+    /**
+     * @brief
+     * @tparam TValue
+     * @param count
+     * @param minimum
+     * @param maximum
+     * @return
+     */
+    template <typename TValue>
+    std::shared_ptr <const std::vector <TValue>>
+    makeUniform (std::size_t count, TValue minimum, TValue maximum)
+    {
+      std::mt19937_64 engine (Seed);
+      std::uniform_real_distribution <TValue> distribution (minimum, maximum);
+
+      std::vector <TValue> values (count);
+      for (TValue & value : values)
+      {
+        value = distribution (engine);
+      }
+
+      return std::make_shared <const std::vector <TValue>> (std::move (values));
+    }
+
+
+    /**
+     * @brief
+     * @tparam TTerm
+     * @tparam TSummationPolicy
+     * @param policy_name
+     * @param type_name
+     */
+    template <typename TTerm, typename TSummationPolicy>
+    void
+    addSummatorCases (const char * policy_name, const char * type_name)
+    {
+      for (const std::size_t size : Sizes)
+      {
+        const std::shared_ptr <const std::vector <TTerm>> terms (makeUniform <TTerm> (size, TTerm (- 1), TTerm (1)));
+        Benchmark::add (
+          fmt::format ("Summator<{0:s}, {1:s}>/{2:d}", policy_name, type_name, size),
+          [terms] (std::size_t iterations)
+          {
+            for (std::size_t iteration (0); iteration < iterations; ++ iteration)
+            {
+              Summator <TTerm, TSummationPolicy> summator;
+              summator.add (terms->cbegin (), terms->cend ());
+              doNotOptimize (TTerm (summator));
+            }
+          }
+        );
+      }
+    }
+
+
+    /**
+     * @brief Throughput of all policies;  their accuracy is compared by  `tests/summator.cxx'.
+     * @tparam TTerm
+     * @param type_name
+     */
+    template <typename TTerm>
+    void
+    addSummatorCases (const char * type_name)
+    {
+      addSummatorCases <TTerm, NaiveSummationPolicy <TTerm>> ("Naive", type_name);
+      addSummatorCases <TTerm, CompensatingSummationPolicy <TTerm>> ("Kahan", type_name);
+      addSummatorCases <TTerm, NeumaierSummationPolicy <TTerm>> ("Neumaier", type_name);
+      addSummatorCases <TTerm, PairwiseSummationPolicy <TTerm>> ("Pairwise", type_name);
+    }
+
+
+    /**
+     * @brief
+     * @tparam TUnsigned
+     * @param type_name
+     */
+    template <typename TUnsigned>
+    void
+    addCtzCases (const char * type_name)
+    {
+      std::mt19937_64 engine (Seed);
+      std::vector <TUnsigned> values (Inputs_count);
+      for (TUnsigned & value : values)
+      {
+        // Uniformly distributed results rather than mostly small ones.
+        value = TUnsigned (TUnsigned (engine () | 1) << (engine () % (8 * sizeof (TUnsigned))));
+        value = (value != 0) ? value : TUnsigned (1);
+      }
+
+      const std::shared_ptr <const std::vector <TUnsigned>> inputs (
+        std::make_shared <const std::vector <TUnsigned>> (std::move (values))
+      );
+
+      Benchmark::add (
+        fmt::format ("ctz<{0:s}>/intrinsic", type_name),
+        [inputs] (std::size_t iterations)
+        {
+          std::size_t total (0);
+          for (std::size_t iteration (0); iteration < iterations; ++ iteration)
+          {
+            total += ctz ((* inputs) [iteration & (Inputs_count - 1)]);
+          }
+
+          doNotOptimize (total);
+        }
+      );
+      Benchmark::add (
+        fmt::format ("ctz<{0:s}>/de-bruijn", type_name),
+        [inputs] (std::size_t iterations)
+        {
+          std::size_t total (0);
+          for (std::size_t iteration (0); iteration < iterations; ++ iteration)
+          {
+            total += CtzInternals_::ctzDeBruijn_ ((* inputs) [iteration & (Inputs_count - 1)]);
+          }
+
+          doNotOptimize (total);
+        }
+      );
+    }
+
+
+    /**
+     * @brief
+     * @tparam TUnsigned
+     * @param type_name
+     */
+    template <typename TUnsigned>
+    void
+    addBitCountCases (const char * type_name)
+    {
+      std::mt19937_64 engine (Seed);
+      std::vector <TUnsigned> values (Inputs_count);
+      for (TUnsigned & value : values)
+      {
+        // Uniformly distributed leading zeros rather than mostly none.
+        value = TUnsigned (TUnsigned (engine ()) >> (engine () % (8 * sizeof (TUnsigned))));
+      }
+
+      const std::shared_ptr <const std::vector <TUnsigned>> inputs (
+        std::make_shared <const std::vector <TUnsigned>> (std::move (values))
+      );
+
+      Benchmark::add (
+        fmt::format ("clz<{0:s}>", type_name),
+        [inputs] (std::size_t iterations)
+        {
+          std::size_t total (0);
+          for (std::size_t iteration (0); iteration < iterations; ++ iteration)
+          {
+            total += clz ((* inputs) [iteration & (Inputs_count - 1)]);
+          }
+
+          doNotOptimize (total);
+        }
+      );
+      Benchmark::add (
+        fmt::format ("popcount<{0:s}>/intrinsic", type_name),
+        [inputs] (std::size_t iterations)
+        {
+          std::size_t total (0);
+          for (std::size_t iteration (0); iteration < iterations; ++ iteration)
+          {
+            total += popcount ((* inputs) [iteration & (Inputs_count - 1)]);
+          }
+
+          doNotOptimize (total);
+        }
+      );
+      Benchmark::add (
+        fmt::format ("popcount<{0:s}>/swar", type_name),
+        [inputs] (std::size_t iterations)
+        {
+          std::size_t total (0);
+          for (std::size_t iteration (0); iteration < iterations; ++ iteration)
+          {
+            total += PopcountInternals_::popcountSwar_ ((* inputs) [iteration & (Inputs_count - 1)]);
+          }
+
+          doNotOptimize (total);
+        }
+      );
+    }
+
+
+    /**
+     * @brief Scans a bitmap of  `Sizes [2]'  bits with one bit in  `period'  set.
+     * @param density_name
+     * @param period
+     */
+    void
+    addBitmapCases (const char * density_name, std::size_t period)
+    {
+      constexpr std::size_t Size (Sizes [2]);
+
+      std::mt19937_64 engine (Seed);
+      const std::shared_ptr <Bitmap> bitmap (std::make_shared <Bitmap> (Size));
+      for (std::size_t index (0); index < Size; ++ index)
+      {
+        if (engine () % period == 0)
+        {
+          bitmap->set (index);
+        }
+      }
+
+      Benchmark::add (
+        fmt::format ("Bitmap/count, {0:s}/{1:d}", density_name, Size),
+        [bitmap] (std::size_t iterations)
+        {
+          for (std::size_t iteration (0); iteration < iterations; ++ iteration)
+          {
+            doNotOptimize (bitmap->count ());
+          }
+        }
+      );
+      Benchmark::add (
+        fmt::format ("Bitmap/findNext, {0:s}/{1:d}", density_name, Size),
+        [bitmap] (std::size_t iterations)
+        {
+          std::size_t total (0);
+          for (std::size_t iteration (0); iteration < iterations; ++ iteration)
+          {
+            for (std::size_t index (bitmap->findFirst ()); index < Size; index = bitmap->findNext (index + 1))
+            {
+              total += index;
+            }
+          }
+
+          doNotOptimize (total);
+        }
+      );
+      Benchmark::add (
+        fmt::format ("Bitmap/forEachSetBit, {0:s}/{1:d}", density_name, Size),
+        [bitmap] (std::size_t iterations)
+        {
+          std::size_t total (0);
+          for (std::size_t iteration (0); iteration < iterations; ++ iteration)
+          {
+            bitmap->forEachSetBit (
+              [& total] (std::size_t index)
+              {
+                total += index;
+              }
+            );
+          }
+
+          doNotOptimize (total);
+        }
+      );
+    }
+
+
+    /**
+     * @brief
+     * @tparam TFloatingPoint
+     * @param type_name
+     */
+    template <typename TFloatingPoint>
+    void
+    addIsCloseCases (const char * type_name)
+    {
+      const std::shared_ptr <const std::vector <TFloatingPoint>> inputs (
+        makeUniform <TFloatingPoint> (Inputs_count + 1, TFloatingPoint (0), TFloatingPoint (1))
+      );
+
+      Benchmark::add (
+        fmt::format ("isClose<{0:s}>", type_name),
+        [inputs] (std::size_t iterations)
+        {
+          std::size_t total (0);
+          for (std::size_t iteration (0); iteration < iterations; ++ iteration)
+          {
+            const std::size_t index (iteration & (Inputs_count - 1));
+            total += isClose ((* inputs) [index], (* inputs) [index + 1]);
+          }
+
+          doNotOptimize (total);
+        }
+      );
+    }
+
+
+    /**
+     * @brief
+     * @tparam TIntegral
+     * @tparam TFloatingPoint
+     * @param type_name
+     */
+    template <typename TIntegral, typename TFloatingPoint>
+    void
+    addRationalizeCases (const char * type_name)
+    {
+      const std::shared_ptr <const std::vector <TFloatingPoint>> inputs (
+        makeUniform <TFloatingPoint> (Inputs_count, TFloatingPoint (0), TFloatingPoint (10))
+      );
+
+      Benchmark::add (
+        fmt::format ("rationalize<{0:s}>", type_name),
+        [inputs] (std::size_t iterations)
+        {
+          for (std::size_t iteration (0); iteration < iterations; ++ iteration)
+          {
+            doNotOptimize (rationalize <TIntegral> ((* inputs) [iteration & (Inputs_count - 1)]));
+          }
+        }
+      );
+    }
+
+
+    /**
+     * @brief
+     * @tparam TValue
+     * @param type_name
+     */
+    template <typename TValue>
+    void
+    addGrid2dCases (const char * type_name)
+    {
+      constexpr std::size_t Side (1 << 8);
+
+      using values_type = std::vector <TValue>;
+
+
+      const std::shared_ptr <const values_type> values (makeUniform <TValue> (Side * Side, TValue (- 1), TValue (1)));
+      const std::shared_ptr <const values_type> xs (makeUniform <TValue> (Inputs_count, TValue (0), TValue (1)));
+      const std::shared_ptr <const values_type> ys (makeUniform <TValue> (Inputs_count, TValue (0), TValue (1)));
+      const std::shared_ptr <const Grid2d <TValue>> grid (
+        std::make_shared <const Grid2d <TValue>> (TValue (0), TValue (1), Side, TValue (0), TValue (1), Side, * values)
+      );
+
+      Benchmark::add (
+        fmt::format ("lerp_2d<{0:s}>/row-major lookup", type_name),
+        [values, xs, ys] (std::size_t iterations)
+        {
+          constexpr TValue Scale (Side - 1);
+
+          TValue total (0);
+          for (std::size_t iteration (0); iteration < iterations; ++ iteration)
+          {
+            const std::size_t input (iteration & (Inputs_count - 1));
+            const TValue x ((* xs) [input]);
+            const TValue y ((* ys) [input]);
+            const std::size_t column (min (std::size_t (x * Scale), Side - 2));
+            const std::size_t row (min (std::size_t (y * Scale), Side - 2));
+            const std::size_t index (row * Side + column);
+            total += lerp_2d (
+              x, y,
+              TValue (column) / Scale, TValue (column + 1) / Scale, TValue (row) / Scale, TValue (row + 1) / Scale,
+              (* values) [index], (* values) [index + Side], (* values) [index + Side + 1], (* values) [index + 1]
+            );
+          }
+
+          doNotOptimize (total);
+        }
+      );
+      Benchmark::add (
+        fmt::format ("Grid2d<{0:s}>/interpolate", type_name),
+        [grid, xs, ys] (std::size_t iterations)
+        {
+          TValue total (0);
+          for (std::size_t iteration (0); iteration < iterations; ++ iteration)
+          {
+            const std::size_t index (iteration & (Inputs_count - 1));
+            total += grid->interpolate ((* xs) [index], (* ys) [index]);
+          }
+
+          doNotOptimize (total);
+        }
+      );
+      Benchmark::add (
+        fmt::format ("Grid2d<{0:s}>/interpolate batch", type_name),
+        [grid, xs, ys] (std::size_t iterations)
+        {
+          std::vector <TValue> out (Inputs_count);
+          for (std::size_t iteration (0); iteration < iterations; iteration += Inputs_count)
+          {
+            grid->interpolate (xs->data (), ys->data (), min (Inputs_count, iterations - iteration), out.data ());
+            clobberMemory ();
+          }
+
+          doNotOptimize (out.front ());
+        }
+      );
+    }
+
+
+    /**
+     * @brief Measures the latency of the synchronous  `Logger',  writing to a discarding  `std::clog'.
+     * @tparam TLog
+     * @param name
+     * @param log Logs the message of the given iteration.
+     */
+    template <typename TLog>
+    void
+    addLoggerCase (const char * name, TLog log)
+    {
+      Benchmark::add_Latency (
+        fmt::format ("Logger::log/{0:s}", name),
+        [log] (std::size_t iterations, double * latencies)
+        {
+          NullBuffer null_buffer;
+          std::streambuf * const buffer (std::clog.rdbuf (& null_buffer));
+
+          const double nanoseconds_per_tick (TscClock::nanosecondsPerTick ());
+          for (std::size_t iteration (0); iteration < iterations; ++ iteration)
+          {
+            const std::uint64_t started (TscClock::ticks ());
+            log (iteration);
+            latencies [iteration] = double (TscClock::ticks () - started) * nanoseconds_per_tick;
+          }
+
+          std::clog.rdbuf (buffer);
+        }
+      );
+    }
+
+
+    /**
+     * @brief Same messages as  `addAsyncLoggerCases',  so the percentiles compare directly.
+     */
+    void
+    addLoggerCases ()
+    {
+      addLoggerCase (
+        "no arguments",
+        [] (std::size_t iteration [[maybe_unused]])
+        {
+          Logger::log ("BENCH", "Nothing happened");
+        }
+      );
+      addLoggerCase (
+        "int, double, CString",
+        [] (std::size_t iteration)
+        {
+          Logger::log ("BENCH", "Iteration  {0:d}:  {1:.3f},  {2:s}", iteration, 0.5, CString ("text"));
+        }
+      );
+
+      const std::shared_ptr <const std::string> text (std::make_shared <const std::string> ("text"));
+      addLoggerCase (
+        "int, double, std::string",
+        [text] (std::size_t iteration)
+        {
+          Logger::log ("BENCH", "Iteration  {0:d}:  {1:.3f},  {2:s}", iteration, 0.5, * text);
+        }
+      );
+    }
+
+
+    /**
+     * @brief Measures the producer side latency of  `AsyncLogger',  the consumer writes to  `/dev/null'.
+     * The logger is started  &  stopped by every run,  so the time per iteration includes formatting the entries
+     *   left in the ring;  the percentiles don't.
+     * @tparam TLog
+     * @param name
+     * @param overflow_policy
+     * @param log Logs the message of the given iteration.
+     */
+    template <typename TLog>
+    void
+    addAsyncLoggerCase (const char * name, AsyncLogOverflowPolicy overflow_policy, TLog log)
+    {
+      Benchmark::add_Latency (
+        fmt::format ("AsyncLogger::log/{0:s}", name),
+        [overflow_policy, log] (std::size_t iterations, double * latencies)
+        {
+          const int file_descriptor (::open ("/dev/null", O_WRONLY));
+          AsyncLogger::start (file_descriptor, overflow_policy);
+
+          const double nanoseconds_per_tick (TscClock::nanosecondsPerTick ());
+          for (std::size_t iteration (0); iteration < iterations; ++ iteration)
+          {
+            const std::uint64_t started (TscClock::ticks ());
+            log (iteration);
+            latencies [iteration] = double (TscClock::ticks () - started) * nanoseconds_per_tick;
+          }
+
+          AsyncLogger::stop ();
+          ::close (file_descriptor);
+        }
+      );
+    }
+
+
+    /**
+     * @brief
+     */
+    void
+    addAsyncLoggerCases ()
+    {
+      addAsyncLoggerCase (
+        "no arguments", AsyncLogOverflowPolicy::Block,
+        [] (std::size_t iteration)
+        {
+          AsyncLogger::log (iteration, "BENCH", "Nothing happened");
+        }
+      );
+      addAsyncLoggerCase (
+        "int, double, CString", AsyncLogOverflowPolicy::Block,
+        [] (std::size_t iteration)
+        {
+          AsyncLogger::log (iteration, "BENCH", "Iteration  {0:d}:  {1:.3f},  {2:s}", iteration, 0.5, CString ("text"));
+        }
+      );
+      addAsyncLoggerCase (
+        "int, double, CString, drop", AsyncLogOverflowPolicy::Drop,
+        [] (std::size_t iteration)
+        {
+          AsyncLogger::log (iteration, "BENCH", "Iteration  {0:d}:  {1:.3f},  {2:s}", iteration, 0.5, CString ("text"));
+        }
+      );
+
+      const std::shared_ptr <const std::string> text (std::make_shared <const std::string> ("text"));
+      addAsyncLoggerCase (
+        "int, double, std::string", AsyncLogOverflowPolicy::Block,
+        [text] (std::size_t iteration)
+        {
+          AsyncLogger::log (iteration, "BENCH", "Iteration  {0:d}:  {1:.3f},  {2:s}", iteration, 0.5, * text);
+        }
+      );
+    }
+
+
+    /**
+     * @brief
+     */
+    void
+    addFormattingCases ()
+    {
+      constexpr std::time_t Time (1'711'846'800);  // 2024-03-31T01:00:00Z
+
+      Benchmark::add (
+        "formatDate_Iso8601/same second",
+        [] (std::size_t iterations)
+        {
+          char buffer [Date_Iso8601_max_size];
+          for (std::size_t iteration (0); iteration < iterations; ++ iteration)
+          {
+            doNotOptimize (formatDate_Iso8601 (Time, std::uint32_t (iteration & 0xffff), 9, buffer));
+            clobberMemory ();
+          }
+        }
+      );
+      Benchmark::add (
+        "formatDate_Iso8601/new second",
+        [] (std::size_t iterations)
+        {
+          char buffer [Date_Iso8601_max_size];
+          for (std::size_t iteration (0); iteration < iterations; ++ iteration)
+          {
+            doNotOptimize (formatDate_Iso8601 (Time + std::time_t (iteration), 0, 9, buffer));
+            clobberMemory ();
+          }
+        }
+      );
+      Benchmark::add (
+        "formatDate_Iso8601/std::string",
+        [] (std::size_t iterations)
+        {
+          const std::chrono::system_clock::time_point now (std::chrono::system_clock::from_time_t (Time));
+          for (std::size_t iteration (0); iteration < iterations; ++ iteration)
+          {
+            doNotOptimize (formatDate_Iso8601 <std::chrono::system_clock> (now));
+          }
+        }
+      );
+
+      Benchmark::add (
+        "formatDuration/buffer",
+        [] (std::size_t iterations)
+        {
+          char buffer [Duration_max_size];
+          for (std::size_t iteration (0); iteration < iterations; ++ iteration)
+          {
+            doNotOptimize (formatDuration (std::chrono::nanoseconds (3'723'004'005'006 + std::int64_t (iteration)), buffer));
+            clobberMemory ();
+          }
+        }
+      );
+      Benchmark::add (
+        "formatDuration/std::string",
+        [] (std::size_t iterations)
+        {
+          for (std::size_t iteration (0); iteration < iterations; ++ iteration)
+          {
+            doNotOptimize (formatDuration (std::chrono::nanoseconds (3'723'004'005'006 + std::int64_t (iteration))));
+          }
+        }
+      );
+    }
+
+
+    /**
+     * @brief Block of the allocation churn cases.
+     */
+    struct alignas (16) ChurnBlock final
+    {
+      /**
+       * @brief
+       */
+      std::byte bytes [64];
+    };
+
+
+    /**
+     * @brief Allocations per round of the churn cases,  twice a pool magazine.
+     */
+    constexpr std::size_t Churn_count (2 * Config::Utils::Pool::Magazine_capacity);
+
+
+    /**
+     * @brief Blocks handed over to another thread,  which frees them.
+     */
+    struct Mailbox final
+    {
+      /**
+       * @brief
+       */
+      std::mutex mutex;
+
+      /**
+       * @brief
+       */
+      std::vector <void *> blocks;
+    };
+
+
+    /**
+     * @brief Runs the churn of  `addAllocationCases'  on  `threads_count'  threads at once:  every iteration each
+     *   thread frees half of its blocks  &  hands the other half over to the next thread,  which frees them,
+     *   so both the thread-local  &  the cross-thread paths are measured.
+     * @tparam TAllocate
+     * @tparam TDeallocate
+     * @param name
+     * @param threads_count
+     * @param allocate
+     * @param deallocate
+     */
+    template <typename TAllocate, typename TDeallocate>
+    void
+    addThreadedAllocationCase (const char * name, std::size_t threads_count, TAllocate allocate, TDeallocate deallocate)
+    {
+      Benchmark::add (
+        fmt::format ("{0:s}/{1:d} threads, {2:d} x {3:d} B", name, threads_count, Churn_count, sizeof (ChurnBlock)),
+        [threads_count, allocate, deallocate] (std::size_t iterations)
+        {
+          std::vector <Mailbox> mailboxes (threads_count);
+          const auto churn (
+            [iterations, threads_count, & allocate, & deallocate, & mailboxes] (std::size_t thread_index)
+            {
+              Mailbox & inbox (mailboxes [thread_index]);
+              Mailbox & outbox (mailboxes [(thread_index + 1) % threads_count]);
+              std::vector <void *> received;
+              void * blocks [Churn_count];
+              for (std::size_t iteration (0); iteration < iterations; ++ iteration)
+              {
+                for (void * & block : blocks)
+                {
+                  block = allocate ();
+                  doNotOptimize (block);
+                }
+
+                for (std::size_t index (Churn_count); index > Churn_count / 2; -- index)
+                {
+                  deallocate (blocks [index - 1]);
+                }
+
+                {
+                  const std::lock_guard <std::mutex> lock (outbox.mutex);
+                  outbox.blocks.insert (outbox.blocks.end (), blocks, blocks + Churn_count / 2);
+                }
+
+                {
+                  const std::lock_guard <std::mutex> lock (inbox.mutex);
+                  received.swap (inbox.blocks);
+                }
+
+                for (void * const block : received)
+                {
+                  deallocate (block);
+                }
+
+                received.clear ();
+              }
+            }
+          );
+
+          std::vector <std::thread> threads;
+          threads.reserve (threads_count - 1);
+          for (std::size_t thread_index (1); thread_index < threads_count; ++ thread_index)
+          {
+            threads.emplace_back (churn, thread_index);
+          }
+
+          churn (0);
+
+          for (std::thread & thread : threads)
+          {
+            thread.join ();
+          }
+
+          for (Mailbox & mailbox : mailboxes)
+          {
+            for (void * const block : mailbox.blocks)
+            {
+              deallocate (block);
+            }
+          }
+        }
+      );
+    }
+
+
+    /**
+     * @brief Allocates  `Churn_count'  blocks of  `sizeof (ChurnBlock)'  bytes per iteration  &  frees them
+     *   in reverse order,  or all at once for  `Arena';  then  `malloc'  &  `Pool'  on 2,  4  &  8 threads.
+     */
+    void
+    addAllocationCases ()
+    {
+      Benchmark::add (
+        fmt::format ("malloc, free/{0:d} x {1:d} B", Churn_count, sizeof (ChurnBlock)),
+        [] (std::size_t iterations)
+        {
+          void * blocks [Churn_count];
+          for (std::size_t iteration (0); iteration < iterations; ++ iteration)
+          {
+            for (void * & block : blocks)
+            {
+              block = std::malloc (sizeof (ChurnBlock));
+              doNotOptimize (block);
+            }
+
+            for (std::size_t index (Churn_count); index > 0; -- index)
+            {
+              std::free (blocks [index - 1]);
+            }
+          }
+        }
+      );
+      Benchmark::add (
+        fmt::format ("Pool/{0:d} x {1:d} B", Churn_count, sizeof (ChurnBlock)),
+        [] (std::size_t iterations)
+        {
+          void * blocks [Churn_count];
+          for (std::size_t iteration (0); iteration < iterations; ++ iteration)
+          {
+            for (void * & block : blocks)
+            {
+              block = Pool <ChurnBlock>::allocate ();
+              doNotOptimize (block);
+            }
+
+            for (std::size_t index (Churn_count); index > 0; -- index)
+            {
+              Pool <ChurnBlock>::deallocate (blocks [index - 1]);
+            }
+          }
+        }
+      );
+      Benchmark::add (
+        fmt::format ("Arena/{0:d} x {1:d} B", Churn_count, sizeof (ChurnBlock)),
+        [] (std::size_t iterations)
+        {
+          Arena arena;
+          for (std::size_t iteration (0); iteration < iterations; ++ iteration)
+          {
+            for (std::size_t index (0); index < Churn_count; ++ index)
+            {
+              doNotOptimize (arena.allocate (sizeof (ChurnBlock), alignof (ChurnBlock)));
+            }
+
+            arena.reset ();
+          }
+        }
+      );
+
+      for (const std::size_t threads_count : { std::size_t (2), std::size_t (4), std::size_t (8) })
+      {
+        addThreadedAllocationCase (
+          "malloc, free", threads_count,
+          [] ()
+          {
+            return std::malloc (sizeof (ChurnBlock));
+          },
+          [] (void * block)
+          {
+            std::free (block);
+          }
+        );
+        addThreadedAllocationCase (
+          "Pool", threads_count,
+          [] ()
+          {
+            return Pool <ChurnBlock>::allocate ();
+          },
+          [] (void * block)
+          {
+            Pool <ChurnBlock>::deallocate (block);
+          }
+        );
+      }
+    }
+
+
+    /**
+     * @brief Hand-written counterpart of  `Expected <int, int>',  the baseline of the  `Expected'  cases.
+     */
+    struct Quotient final
+    {
+      /**
+       * @brief
+       */
+      int value;
+
+      /**
+       * @brief Zero on success.
+       */
+      int error;
+    };
+
+
+    /**
+     * @brief Never inlined,  so the cases measure passing the result across a call.
+     * @tparam TSafetyPolicy
+     * @param x
+     * @param y
+     * @return
+     */
+    template <typename TSafetyPolicy>
+    [[gnu::noinline]] Expected <int, int, TSafetyPolicy>
+    divide (int x, int y) noexcept
+    {
+      if (y == 0)
+      {
+        return Unexpected (x);
+      }
+
+      return x / y;
+    }
+
+
+    /**
+     * @brief Never inlined,  so the cases measure passing the result across a call.
+     * @param x
+     * @param y
+     * @return
+     */
+    [[gnu::noinline]] Quotient
+    divideRaw (int x, int y) noexcept
+    {
+      if (y == 0)
+      {
+        return Quotient { 0, x };
+      }
+
+      return Quotient { x / y, 0 };
+    }
+
+
+    /**
+     * @brief
+     * @tparam TSafetyPolicy
+     * @param type_name
+     */
+    template <typename TSafetyPolicy>
+    void
+    addExpectedCases (const char * type_name)
+    {
+      Benchmark::add (
+        fmt::format ("{0:s}/result", type_name),
+        [] (std::size_t iterations)
+        {
+          int total (0);
+          for (std::size_t iteration (0); iteration < iterations; ++ iteration)
+          {
+            const Expected <int, int, TSafetyPolicy> quotient (divide <TSafetyPolicy> (int (iteration & 0xff), 3));
+            total += (quotient) ? quotient.result () : quotient.error ();
+          }
+
+          doNotOptimize (total);
+        }
+      );
+      Benchmark::add (
+        fmt::format ("{0:s}/mixed", type_name),
+        [] (std::size_t iterations)
+        {
+          int total (0);
+          for (std::size_t iteration (0); iteration < iterations; ++ iteration)
+          {
+            const Expected <int, int, TSafetyPolicy> quotient (
+              divide <TSafetyPolicy> (int (iteration & 0xff), int (iteration & 1))
+            );
+            total += (quotient) ? quotient.result () : quotient.error ();
+          }
+
+          doNotOptimize (total);
+        }
+      );
+      Benchmark::add (
+        fmt::format ("{0:s}/andThen", type_name),
+        [] (std::size_t iterations)
+        {
+          int total (0);
+          for (std::size_t iteration (0); iteration < iterations; ++ iteration)
+          {
+            const Expected <int, int, TSafetyPolicy> quotient (
+              divide <TSafetyPolicy> (int (iteration & 0xff), int (iteration & 1)).andThen (
+                [] (int value) noexcept
+                {
+                  return divide <TSafetyPolicy> (value, 3);
+                }
+              )
+            );
+            total += (quotient) ? quotient.result () : quotient.error ();
+          }
+
+          doNotOptimize (total);
+        }
+      );
+    }
+  }
+
+
+  void
+  registerUtilityBenchmarks ()
+  {
+    addSummatorCases <float> ("float");
+    addSummatorCases <double> ("double");
+
+    addCtzCases <std::uint32_t> ("uint32_t");
+    addCtzCases <std::uint64_t> ("uint64_t");
+
+    addBitCountCases <std::uint32_t> ("uint32_t");
+    addBitCountCases <std::uint64_t> ("uint64_t");
+
+    addBitmapCases ("sparse", 64);
+    addBitmapCases ("dense", 2);
+
+    addRationalizeCases <int, float> ("int, float");
+    addRationalizeCases <long, double> ("long, double");
+
+    addIsCloseCases <float> ("float");
+    addIsCloseCases <double> ("double");
+
+    addGrid2dCases <float> ("float");
+    addGrid2dCases <double> ("double");
+
+    addLoggerCases ();
+
+    addAsyncLoggerCases ();
+
+    addFormattingCases ();
+
+    addAllocationCases ();
+
+    Benchmark::add (
+      "Timer/start, stop, timeElapsed",
+      [] (std::size_t iterations)
+      {
+        Timer timer (Timer::is_automatic_flag (false));
+        for (std::size_t iteration (0); iteration < iterations; ++ iteration)
+        {
+          timer.start ();
+          timer.stop ();
+          doNotOptimize (timer.timeElapsed ());
+        }
+      }
+    );
+
+    addExpectedCases <UncheckedPolicy> ("Expected<int, int>");
+    addExpectedCases <CheckedNoDiscardPolicy> ("Expected<int, int, CheckedNoDiscardPolicy>");
+
+    Benchmark::add (
+      "Quotient/result",
+      [] (std::size_t iterations)
+      {
+        int total (0);
+        for (std::size_t iteration (0); iteration < iterations; ++ iteration)
+        {
+          const Quotient quotient (divideRaw (int (iteration & 0xff), 3));
+          total += (quotient.error == 0) ? quotient.value : quotient.error;
+        }
+
+        doNotOptimize (total);
+      }
+    );
+    Benchmark::add (
+      "Quotient/mixed",
+      [] (std::size_t iterations)
+      {
+        int total (0);
+        for (std::size_t iteration (0); iteration < iterations; ++ iteration)
+        {
+          const Quotient quotient (divideRaw (int (iteration & 0xff), int (iteration & 1)));
+          total += (quotient.error == 0) ? quotient.value : quotient.error;
+        }
+
+        doNotOptimize (total);
+      }
+    );
+    Benchmark::add (
+      "Quotient/chained",
+      [] (std::size_t iterations)
+      {
+        int total (0);
+        for (std::size_t iteration (0); iteration < iterations; ++ iteration)
+        {
+          Quotient quotient (divideRaw (int (iteration & 0xff), int (iteration & 1)));
+          if (quotient.error == 0)
+          {
+            quotient = divideRaw (quotient.value, 3);
+          }
+
+          total += (quotient.error == 0) ? quotient.value : quotient.error;
+        }
+
+        doNotOptimize (total);
+      }
+    );
+  }
+}
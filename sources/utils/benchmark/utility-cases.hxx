@@ -0,0 +1,18 @@
+#ifndef UTILS_BENCHMARK_UTILITYCASES_HXX
+#define UTILS_BENCHMARK_UTILITYCASES_HXX
+
+
+namespace Utils
+{
+  /**
+   * @brief Registers benchmark cases for the hot utilities:  `Summator'  policies,  `ctz',  `clz',  `popcount',
+   *   `Bitmap',  `rationalize',  `isClose',  `Logger::log',  `AsyncLogger::log',  `formatDate_Iso8601',
+   *   `formatDuration',  `Pool'  &  `Arena'  against  `malloc',  `Timer'  &  `Expected',  across input sizes  &  types.
+   * A benchmark program is then just  `registerUtilityBenchmarks ();  return Benchmark::main (argc, argv);'.
+   */
+  void
+  registerUtilityBenchmarks ();
+}
+
+
+#endif  // UTILS_BENCHMARK_UTILITYCASES_HXX
@@ -0,0 +1,17 @@
+#ifndef UTILS_CONFIG_ARENA_HXX
+#define UTILS_CONFIG_ARENA_HXX
+
+
+#include <cstddef>  // std::size_t
+
+
+namespace Config::Utils::Arena
+{
+  /**
+   * @brief Default size of the chunks an arena requests from the system,  in bytes.
+   */
+  inline constexpr std::size_t Chunk_size (1 << 16);
+}
+
+
+#endif  // UTILS_CONFIG_ARENA_HXX
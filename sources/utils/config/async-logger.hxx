@@ -0,0 +1,24 @@
+#ifndef UTILS_CONFIG_ASYNCLOGGER_HXX
+#define UTILS_CONFIG_ASYNCLOGGER_HXX
+
+
+#include <cstddef>  // std::size_t
+
+#include <chrono>  // std::chrono::{microseconds, milliseconds}
+
+
+namespace Config::Utils::AsyncLogger
+{
+  inline constexpr std::size_t Ring_capacity (1 << 10);
+
+  inline constexpr std::size_t Arguments_capacity (128);
+
+  inline constexpr std::size_t Batch_size (1 << 16);
+
+  inline constexpr std::chrono::microseconds Poll_interval (500);
+
+  inline constexpr std::chrono::milliseconds Crash_flush_timeout (100);
+}
+
+
+#endif  // UTILS_CONFIG_ASYNCLOGGER_HXX
@@ -0,0 +1,34 @@
+#ifndef UTILS_CONFIG_BENCHMARK_HXX
+#define UTILS_CONFIG_BENCHMARK_HXX
+
+
+#include <cstddef>  // std::size_t
+
+#include <chrono>  // std::chrono::milliseconds
+
+
+namespace Config::Utils::Benchmark
+{
+  /**
+   * @brief How long a case runs before measuring.
+   */
+  inline constexpr std::chrono::milliseconds Warmup_time (100);
+
+  /**
+   * @brief Minimal duration of one trial;  the iterations count is calibrated to reach it.
+   */
+  inline constexpr std::chrono::milliseconds Trial_time (20);
+
+  /**
+   * @brief
+   */
+  inline constexpr std::size_t Trials (15);
+
+  /**
+   * @brief Relative slowdown of the median time that counts as a regression.
+   */
+  inline constexpr double Regression_threshold (0.05);
+}
+
+
+#endif  // UTILS_CONFIG_BENCHMARK_HXX
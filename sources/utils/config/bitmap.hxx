@@ -0,0 +1,18 @@
+#ifndef UTILS_CONFIG_BITMAP_HXX
+#define UTILS_CONFIG_BITMAP_HXX
+
+
+#include <cstddef>  // std::size_t
+
+
+namespace Config::Utils::Bitmap
+{
+  /**
+   * @brief Number of words processed per step by bulk operations;  a multiple of the SIMD width in words lets the
+   *   compiler vectorize them.
+   */
+  inline constexpr std::size_t Lanes (8);
+}
+
+
+#endif  // UTILS_CONFIG_BITMAP_HXX
@@ -0,0 +1,19 @@
+#ifndef UTILS_CONFIG_FORMATDATEISO8601_HXX
+#define UTILS_CONFIG_FORMATDATEISO8601_HXX
+
+
+#include <chrono>  // std::chrono::minutes
+
+
+namespace Config::Utils::FormatDate_Iso8601
+{
+  /**
+   * @brief How long a cached UTC offset stays valid.
+   * Most time zone transitions happen at whole quarter-hours of UTC,  but historical ones  (e. g. from local mean
+   *   time)  don't,  so an interval whose ends have different offsets is not cached beyond the current second.
+   */
+  inline constexpr std::chrono::minutes Offset_refresh_interval (15);
+}
+
+
+#endif  // UTILS_CONFIG_FORMATDATEISO8601_HXX
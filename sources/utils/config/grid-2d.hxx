@@ -0,0 +1,22 @@
+#ifndef UTILS_CONFIG_GRID2D_HXX
+#define UTILS_CONFIG_GRID2D_HXX
+
+
+#include <cstddef>  // std::size_t
+
+
+namespace Config::Utils::Grid2d
+{
+  /**
+   * @brief Number of query points located  &  interpolated per step by the batch kernels.
+   */
+  inline constexpr std::size_t Lanes (8);
+
+  /**
+   * @brief Number of query points per chunk of  `interpolate_Parallel';  a multiple of  `Lanes'.
+   */
+  inline constexpr std::size_t Parallel_chunk_size (1 << 14);
+}
+
+
+#endif  // UTILS_CONFIG_GRID2D_HXX
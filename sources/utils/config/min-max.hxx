@@ -0,0 +1,14 @@
+#ifndef UTILS_CONFIG_MINMAX_HXX
+#define UTILS_CONFIG_MINMAX_HXX
+
+
+#include <cstddef>  // std::size_t
+
+
+namespace Config::Utils::MinMax
+{
+  inline constexpr std::size_t Lanes (8);
+}
+
+
+#endif  // UTILS_CONFIG_MINMAX_HXX
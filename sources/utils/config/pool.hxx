@@ -0,0 +1,23 @@
+#ifndef UTILS_CONFIG_POOL_HXX
+#define UTILS_CONFIG_POOL_HXX
+
+
+#include <cstddef>  // std::size_t
+
+
+namespace Config::Utils::Pool
+{
+  /**
+   * @brief Size of the chunks the pools request from the system,  in bytes.
+   */
+  inline constexpr std::size_t Slab_size (1 << 16);
+
+  /**
+   * @brief Number of free blocks a thread keeps cached per pool;  half of it is moved to or from the shared free
+   *   list at once.
+   */
+  inline constexpr std::size_t Magazine_capacity (64);
+}
+
+
+#endif  // UTILS_CONFIG_POOL_HXX
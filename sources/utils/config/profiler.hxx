@@ -0,0 +1,22 @@
+#ifndef UTILS_CONFIG_PROFILER_HXX
+#define UTILS_CONFIG_PROFILER_HXX
+
+
+#include <cstddef>  // std::size_t
+
+
+namespace Config::Utils::Profiler
+{
+  inline constexpr std::size_t Max_nodes (256);
+
+  inline constexpr std::size_t Trace_capacity (1 << 16);
+
+  inline constexpr std::size_t Trace_chunk_size (1 << 10);
+
+  inline constexpr std::size_t Histogram_sub_buckets_log2 (2);
+
+  inline constexpr std::size_t Histogram_octaves (40);
+}
+
+
+#endif  // UTILS_CONFIG_PROFILER_HXX
@@ -0,0 +1,20 @@
+#ifndef UTILS_CONFIG_SUMMATOR_HXX
+#define UTILS_CONFIG_SUMMATOR_HXX
+
+
+#include <cstddef>  // std::size_t
+
+
+namespace Config::Utils::Summator
+{
+  inline constexpr std::size_t Lanes (8);
+
+  inline constexpr std::size_t Pairwise_block_size (32);
+
+  inline constexpr std::size_t Parallel_chunk_size (1 << 16);
+
+  inline constexpr std::size_t Parallel_threshold (1 << 20);
+}
+
+
+#endif  // UTILS_CONFIG_SUMMATOR_HXX
@@ -2,12 +2,23 @@
 #define UTILS_CONFIG_TIMER_HXX
 
 
+#include <chrono>  // std::chrono::steady_clock
+
 #include "../containers/c-string.hxx"  // CString
+#ifdef WITH_TSC_CLOCK
+#include "../date-time/tsc-clock.hxx"  // TscClock
+#endif  // WITH_TSC_CLOCK
 
 
 namespace Config::Utils::Timer
 {
   inline constexpr ::Utils::CString Default_description ("(no description)");
+
+#ifdef WITH_TSC_CLOCK
+  using Clock = ::Utils::TscClock;
+#else  // WITH_TSC_CLOCK
+  using Clock = std::chrono::steady_clock;
+#endif  // WITH_TSC_CLOCK
 }
 
 
@@ -0,0 +1,14 @@
+#ifndef UTILS_CONFIG_TSCCLOCK_HXX
+#define UTILS_CONFIG_TSCCLOCK_HXX
+
+
+#include <chrono>  // std::chrono::milliseconds
+
+
+namespace Config::Utils::TscClock
+{
+  inline constexpr std::chrono::milliseconds Calibration_interval (10);
+}
+
+
+#endif  // UTILS_CONFIG_TSCCLOCK_HXX
@@ -0,0 +1,229 @@
+#include "bitmap.hxx"  // Bitmap
+
+#include <cstddef>  // std::size_t
+
+#include "../algorithms/ctz.hxx"  // ctz
+#include "../algorithms/popcount.hxx"  // popcount
+#include "../config/bitmap.hxx"  // Config::Utils::Bitmap::Lanes
+#include "../debug/assert.hxx"  // ASSERT
+
+
+namespace Utils
+{
+  namespace
+  {
+    /**
+     * @brief Applies  `operation'  to the word arrays,  `Lanes'  words per step.
+     * @tparam TOperation
+     * @param words
+     * @param that_words
+     * @param count
+     * @param operation
+     */
+    template <typename TOperation>
+    void
+    combineWords (
+      Bitmap::word_type * words, const Bitmap::word_type * that_words, std::size_t count, TOperation operation
+    ) noexcept
+    {
+      using Config::Utils::Bitmap::Lanes;
+
+
+      std::size_t index (0);
+      for (; index + Lanes <= count; index += Lanes)
+      {
+        for (std::size_t lane (0); lane < Lanes; ++ lane)
+        {
+          words [index + lane] = operation (words [index + lane], that_words [index + lane]);
+        }
+      }
+
+      for (; index < count; ++ index)
+      {
+        words [index] = operation (words [index], that_words [index]);
+      }
+    }
+  }
+
+
+  Bitmap::Bitmap (std::size_t size, bool value) :
+    words_ ((size + word_width_ - 1) / word_width_, (value) ? ~ word_type (0) : word_type (0)),
+    size_ (size)
+  {
+    trim_ ();
+  }
+
+
+  void
+  Bitmap::reset () noexcept
+  {
+    for (word_type & word : words_)
+    {
+      word = 0;
+    }
+  }
+
+
+  void
+  Bitmap::resize (std::size_t size, bool value)
+  {
+    if (value && (size > size_) && (size_ % word_width_ != 0))
+    {
+      words_.back () |= ~ word_type (0) << (size_ % word_width_);
+    }
+
+    words_.resize ((size + word_width_ - 1) / word_width_, (value) ? ~ word_type (0) : word_type (0));
+    size_ = size;
+    trim_ ();
+  }
+
+
+  std::size_t
+  Bitmap::count () const noexcept
+  {
+    using Config::Utils::Bitmap::Lanes;
+
+
+    const word_type * const words (words_.data ());
+    const std::size_t words_count (words_.size ());
+
+    std::size_t counts [Lanes] { };
+    std::size_t index (0);
+    for (; index + Lanes <= words_count; index += Lanes)
+    {
+      for (std::size_t lane (0); lane < Lanes; ++ lane)
+      {
+        counts [lane] += popcount (words [index + lane]);
+      }
+    }
+
+    std::size_t total (0);
+    for (; index < words_count; ++ index)
+    {
+      total += popcount (words [index]);
+    }
+
+    for (std::size_t lane (0); lane < Lanes; ++ lane)
+    {
+      total += counts [lane];
+    }
+
+    return total;
+  }
+
+
+  bool
+  Bitmap::any () const noexcept
+  {
+    return findFirst () != size_;
+  }
+
+
+  std::size_t
+  Bitmap::findNext (std::size_t from) const noexcept
+  {
+    using Config::Utils::Bitmap::Lanes;
+
+
+    if (! (from < size_))
+    {
+      return size_;
+    }
+
+    const word_type * const words (words_.data ());
+    const std::size_t words_count (words_.size ());
+
+    std::size_t index (from / word_width_);
+    const word_type first_word (words [index] & (~ word_type (0) << (from % word_width_)));
+    if (first_word != 0)
+    {
+      return index * word_width_ + ctz (first_word);
+    }
+
+    ++ index;
+    for (; index + Lanes <= words_count; index += Lanes)
+    {
+      word_type block (0);
+      for (std::size_t lane (0); lane < Lanes; ++ lane)
+      {
+        block |= words [index + lane];
+      }
+
+      if (block != 0)
+      {
+        break;
+      }
+    }
+
+    for (; index < words_count; ++ index)
+    {
+      if (words [index] != 0)
+      {
+        return index * word_width_ + ctz (words [index]);
+      }
+    }
+
+    return size_;
+  }
+
+
+  Bitmap &
+  Bitmap::andNot (const self_type & that) noexcept
+  {
+    ASSERT (size_ == that.size_, "`that'  must have the same size");
+
+    combineWords (
+      words_.data (), that.words_.data (), words_.size (),
+      [] (word_type x, word_type y)
+      {
+        return x & ~ y;
+      }
+    );
+
+    return * this;
+  }
+
+
+  Bitmap &
+  Bitmap::operator &= (const self_type & that) noexcept
+  {
+    ASSERT (size_ == that.size_, "`that'  must have the same size");
+
+    combineWords (
+      words_.data (), that.words_.data (), words_.size (),
+      [] (word_type x, word_type y)
+      {
+        return x & y;
+      }
+    );
+
+    return * this;
+  }
+
+
+  Bitmap &
+  Bitmap::operator |= (const self_type & that) noexcept
+  {
+    ASSERT (size_ == that.size_, "`that'  must have the same size");
+
+    combineWords (
+      words_.data (), that.words_.data (), words_.size (),
+      [] (word_type x, word_type y)
+      {
+        return x | y;
+      }
+    );
+
+    return * this;
+  }
+
+
+  void
+  Bitmap::trim_ () noexcept
+  {
+    if (size_ % word_width_ != 0)
+    {
+      words_.back () &= ~ (~ word_type (0) << (size_ % word_width_));
+    }
+  }
+}
@@ -0,0 +1,315 @@
+#ifndef UTILS_CONTAINERS_BITMAP_HXX
+#define UTILS_CONTAINERS_BITMAP_HXX
+
+
+#include <cstddef>  // std::size_t
+#include <cstdint>  // std::uint64_t
+
+#include <utility>  // std::{exchange, move}
+#include <vector>  // std::vector
+
+#include "../algorithms/ctz.hxx"  // ctz
+
+
+namespace Utils
+{
+  /**
+   * @brief Dynamically sized bitmap for scanning large sets,  e. g. occupancy maps.
+   * Bits are packed into 64-bit words;  bits past  `size ()'  in the last word are always zero,  so whole-word
+   *   operations never need masking.  Bulk operations process  `Config::Utils::Bitmap::Lanes'  words per step.
+   */
+  class Bitmap final
+  {
+    public:
+      /**
+       * @brief
+       */
+      using word_type = std::uint64_t;
+
+
+    private:
+      /**
+       * @brief
+       */
+      using self_type = Bitmap;
+
+
+    public:
+      /**
+       * @brief
+       */
+      Bitmap () noexcept = default;
+
+      /**
+       * @brief
+       * @param that
+       */
+      Bitmap (const self_type & that [[maybe_unused]]) = default;
+
+      /**
+       * @brief Leaves  `that'  empty.
+       * @param that
+       */
+      Bitmap (self_type && that) noexcept :
+        words_ (std::move (that.words_)),
+        size_ (std::exchange (that.size_, 0))
+      {
+        that.words_.clear ();
+      }
+
+
+      /**
+       * @brief
+       * @param size
+       * @param value
+       */
+      explicit Bitmap (std::size_t size, bool value = false);
+
+
+      /**
+       * @brief
+       * @return
+       */
+      [[nodiscard]] std::size_t
+      size () const noexcept
+      {
+        return size_;
+      }
+
+
+      /**
+       * @brief
+       * @return
+       */
+      [[nodiscard]] const word_type *
+      data () const noexcept
+      {
+        return words_.data ();
+      }
+
+
+      /**
+       * @brief
+       * @param index
+       * @return
+       */
+      [[nodiscard]] bool
+      test (std::size_t index) const noexcept
+      {
+        return ((words_ [index / word_width_] >> (index % word_width_)) & 1) != 0;
+      }
+
+
+      /**
+       * @brief
+       * @param index
+       */
+      void
+      set (std::size_t index) noexcept
+      {
+        words_ [index / word_width_] |= word_type (1) << (index % word_width_);
+      }
+
+
+      /**
+       * @brief
+       * @param index
+       */
+      void
+      unset (std::size_t index) noexcept
+      {
+        words_ [index / word_width_] &= ~ (word_type (1) << (index % word_width_));
+      }
+
+
+      /**
+       * @brief Unsets all bits.
+       */
+      void
+      reset () noexcept;
+
+
+      /**
+       * @brief
+       * @param size
+       * @param value Value of the appended bits.
+       */
+      void
+      resize (std::size_t size, bool value = false);
+
+
+      /**
+       * @brief
+       * @return Number of set bits.
+       */
+      [[nodiscard]] std::size_t
+      count () const noexcept;
+
+
+      /**
+       * @brief
+       * @return
+       */
+      [[nodiscard]] bool
+      any () const noexcept;
+
+
+      /**
+       * @brief
+       * @return
+       */
+      [[nodiscard]] bool
+      none () const noexcept
+      {
+        return ! any ();
+      }
+
+
+      /**
+       * @brief
+       * @return Index of the lowest set bit,  or  `size ()'  if there's none.
+       */
+      [[nodiscard]] std::size_t
+      findFirst () const noexcept
+      {
+        return findNext (0);
+      }
+
+
+      /**
+       * @brief Skips zero words  `Lanes'  at a time.
+       * @param from
+       * @return Index of the lowest set bit not less than  `from',  or  `size ()'  if there's none.
+       */
+      [[nodiscard]] std::size_t
+      findNext (std::size_t from) const noexcept;
+
+
+      /**
+       * @brief Calls  `function (index)'  for every set bit in ascending order.
+       * @tparam TFunction
+       * @param function
+       */
+      template <typename TFunction>
+      void
+      forEachSetBit (TFunction && function) const
+      {
+        const std::size_t words_count (words_.size ());
+        for (std::size_t word_index (0); word_index < words_count; ++ word_index)
+        {
+          word_type word (words_ [word_index]);
+          while (word != 0)
+          {
+            function (word_index * word_width_ + ctz (word));
+            word &= word - 1;
+          }
+        }
+      }
+
+
+      /**
+       * @brief  `* this := * this & ~ that'.
+       * @param that Bitmap of the same size.
+       * @return
+       */
+      self_type &
+      andNot (const self_type & that) noexcept;
+
+
+      /**
+       * @brief
+       * @param that
+       * @return
+       */
+      self_type &
+      operator = (const self_type & that [[maybe_unused]]) = default;
+
+      /**
+       * @brief Leaves  `that'  empty.
+       * @param that
+       * @return
+       */
+      self_type &
+      operator = (self_type && that) noexcept
+      {
+        if (this != & that)
+        {
+          words_ = std::move (that.words_);
+          that.words_.clear ();
+          size_ = std::exchange (that.size_, 0);
+        }
+
+        return * this;
+      }
+
+
+      /**
+       * @brief
+       * @param that Bitmap of the same size.
+       * @return
+       */
+      self_type &
+      operator &= (const self_type & that) noexcept;
+
+
+      /**
+       * @brief
+       * @param that Bitmap of the same size.
+       * @return
+       */
+      self_type &
+      operator |= (const self_type & that) noexcept;
+
+
+      /**
+       * @brief
+       * @param that
+       * @return
+       */
+      [[nodiscard]] bool
+      operator == (const self_type & that) const noexcept
+      {
+        return (size_ == that.size_) && (words_ == that.words_);
+      }
+
+
+      /**
+       * @brief
+       * @param that
+       * @return
+       */
+      [[nodiscard]] bool
+      operator != (const self_type & that) const noexcept
+      {
+        return ! operator == (that);
+      }
+
+
+    private:
+      /**
+       * @brief Clears the bits past  `size_'  in the last word.
+       */
+      void
+      trim_ () noexcept;
+
+
+      /**
+       * @brief
+       */
+      static constexpr std::size_t word_width_ { 8 * sizeof (word_type) };
+
+
+      /**
+       * @brief
+       */
+      std::vector <word_type> words_;
+
+      /**
+       * @brief
+       */
+      std::size_t size_ { };
+  };
+}
+
+
+#endif  // UTILS_CONTAINERS_BITMAP_HXX
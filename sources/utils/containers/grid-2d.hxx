@@ -0,0 +1,366 @@
+#ifndef UTILS_CONTAINERS_GRID2D_HXX
+#define UTILS_CONTAINERS_GRID2D_HXX
+
+
+#include <cstddef>  // std::size_t
+
+#include <type_traits>  // std::is_floating_point_v
+#include <utility>  // std::move
+#include <vector>  // std::vector
+
+#include "../algorithms/lerp-2d.hxx"  // lerp_2d
+#include "../algorithms/parallel-for.hxx"  // parallelFor
+#include "../config/grid-2d.hxx"  // Config::Utils::Grid2d::{Lanes, Parallel_chunk_size}
+#include "../debug/assert.hxx"  // ASSERT
+
+
+namespace Utils
+{
+  /**
+   * @brief Values sampled on a regular  `columns'  x  `rows'  grid,  bilinearly interpolated with  `lerp_2d'.
+   * Values are stored row-major;  the cell of a point is found with a multiplication instead of a search.
+   * Points outside the grid are extrapolated from the nearest cell,  just like  `lerp_2d'  does.
+   * @tparam TValue
+   */
+  template <typename TValue>
+  class Grid2d final
+  {
+    static_assert (std::is_floating_point_v <TValue>);
+
+
+    public:
+      /**
+       * @brief
+       */
+      using value_type = TValue;
+
+
+    private:
+      /**
+       * @brief
+       */
+      using self_type = Grid2d;
+
+
+    public:
+      /**
+       * @brief
+       */
+      Grid2d () noexcept = delete;
+
+      /**
+       * @brief
+       * @param that
+       */
+      Grid2d (const self_type & that [[maybe_unused]]) = default;
+
+      /**
+       * @brief
+       * @param that
+       */
+      Grid2d (self_type && that [[maybe_unused]]) noexcept = default;
+
+
+      /**
+       * @brief
+       * @param x_0 X of the first column.
+       * @param x_1 X of the last column.
+       * @param columns
+       * @param y_0 Y of the first row.
+       * @param y_1 Y of the last row.
+       * @param rows
+       * @param values  `columns * rows'  values,  row-major.
+       */
+      Grid2d (
+        value_type x_0, value_type x_1, std::size_t columns,
+        value_type y_0, value_type y_1, std::size_t rows,
+        std::vector <value_type> values
+      ) :
+        xs_ (makeAxis_ (x_0, x_1, columns)),
+        ys_ (makeAxis_ (y_0, y_1, rows)),
+        x_scale_ (value_type (columns - 1) / (x_1 - x_0)),
+        y_scale_ (value_type (rows - 1) / (y_1 - y_0)),
+        values_ (std::move (values))
+      {
+        ASSERT (values_.size () == columns * rows, "`values'  must hold  `columns * rows'  values");
+      }
+
+
+      /**
+       * @brief
+       * @return
+       */
+      [[nodiscard]] std::size_t
+      columns () const noexcept
+      {
+        return xs_.size ();
+      }
+
+
+      /**
+       * @brief
+       * @return
+       */
+      [[nodiscard]] std::size_t
+      rows () const noexcept
+      {
+        return ys_.size ();
+      }
+
+
+      /**
+       * @brief
+       * @param column
+       * @return
+       */
+      [[nodiscard]] value_type
+      x (std::size_t column) const noexcept
+      {
+        return xs_ [column];
+      }
+
+
+      /**
+       * @brief
+       * @param row
+       * @return
+       */
+      [[nodiscard]] value_type
+      y (std::size_t row) const noexcept
+      {
+        return ys_ [row];
+      }
+
+
+      /**
+       * @brief
+       * @param column
+       * @param row
+       * @return
+       */
+      [[nodiscard]] value_type
+      at (std::size_t column, std::size_t row) const noexcept
+      {
+        ASSERT (column < columns (), "`column'  must be less than  `columns ()'");
+        ASSERT (row < rows (), "`row'  must be less than  `rows ()'");
+
+        return values_ [row * columns () + column];
+      }
+
+
+      /**
+       * @brief
+       * @param x
+       * @param y
+       * @return
+       */
+      [[nodiscard]] value_type
+      interpolate (value_type x, value_type y) const noexcept
+      {
+        return interpolate_ (x, y, locate_ (x, xs_, x_scale_), locate_ (y, ys_, y_scale_));
+      }
+
+
+      /**
+       * @brief Interpolates  `count'  points  (xs [i], ys [i])  into  `out [i]';  `out'  may be  `xs'  or  `ys'.
+       * Corners of  `Config::Utils::Grid2d::Lanes'  points are gathered first  &  then  `lerp_2d'  runs over all the
+       *   lanes at once,  so the compiler vectorizes the arithmetic,  divisions included.
+       * @param xs
+       * @param ys
+       * @param count
+       * @param out
+       */
+      void
+      interpolate (const value_type * xs, const value_type * ys, std::size_t count, value_type * out) const noexcept
+      {
+        constexpr std::size_t Lanes (Config::Utils::Grid2d::Lanes);
+
+        std::size_t index (0);
+        for (; count - index >= Lanes; index += Lanes)
+        {
+          value_type x [Lanes];
+          value_type y [Lanes];
+          value_type x_0 [Lanes];
+          value_type x_1 [Lanes];
+          value_type y_0 [Lanes];
+          value_type y_1 [Lanes];
+          value_type z_0_0 [Lanes];
+          value_type z_1_0 [Lanes];
+          value_type z_0_1 [Lanes];
+          value_type z_1_1 [Lanes];
+          for (std::size_t lane (0); lane < Lanes; ++ lane)
+          {
+            x [lane] = xs [index + lane];
+            y [lane] = ys [index + lane];
+
+            const std::size_t cell_column (locate_ (x [lane], xs_, x_scale_));
+            const std::size_t cell_row (locate_ (y [lane], ys_, y_scale_));
+            const std::size_t corner (cell_row * xs_.size () + cell_column);
+            x_0 [lane] = xs_ [cell_column];
+            x_1 [lane] = xs_ [cell_column + 1];
+            y_0 [lane] = ys_ [cell_row];
+            y_1 [lane] = ys_ [cell_row + 1];
+            z_0_0 [lane] = values_ [corner];
+            z_1_0 [lane] = values_ [corner + 1];
+            z_0_1 [lane] = values_ [corner + xs_.size ()];
+            z_1_1 [lane] = values_ [corner + xs_.size () + 1];
+          }
+
+          for (std::size_t lane (0); lane < Lanes; ++ lane)
+          {
+            out [index + lane] = lerp_2d (
+              x [lane], y [lane],
+              x_0 [lane], x_1 [lane], y_0 [lane], y_1 [lane],
+              z_0_0 [lane], z_0_1 [lane], z_1_1 [lane], z_1_0 [lane]
+            );
+          }
+        }
+
+        for (; index < count; ++ index)
+        {
+          out [index] = interpolate (xs [index], ys [index]);
+        }
+      }
+
+
+      /**
+       * @brief Same as  `interpolate (xs, ys, count, out)',  chunks of  `Config::Utils::Grid2d::Parallel_chunk_size'
+       *   points are interpolated on all available cores  (see  `parallelFor').
+       * @param xs
+       * @param ys
+       * @param count
+       * @param out
+       */
+      void
+      interpolate_Parallel (const value_type * xs, const value_type * ys, std::size_t count, value_type * out) const
+      {
+        parallelFor (
+          count, Config::Utils::Grid2d::Parallel_chunk_size,
+          [this, xs, ys, out] (std::size_t chunk_first, std::size_t chunk_last)
+          {
+            interpolate (xs + chunk_first, ys + chunk_first, chunk_last - chunk_first, out + chunk_first);
+          }
+        );
+      }
+
+
+      /**
+       * @brief
+       * @param that
+       * @return
+       */
+      self_type &
+      operator = (const self_type & that [[maybe_unused]]) = default;
+
+      /**
+       * @brief
+       * @param that
+       * @return
+       */
+      self_type &
+      operator = (self_type && that [[maybe_unused]]) noexcept = default;
+
+
+    private:
+      /**
+       * @brief
+       */
+      std::vector <value_type> xs_;
+
+      /**
+       * @brief
+       */
+      std::vector <value_type> ys_;
+
+      /**
+       * @brief Cells per unit of x.
+       */
+      value_type x_scale_;
+
+      /**
+       * @brief Cells per unit of y.
+       */
+      value_type y_scale_;
+
+      /**
+       * @brief Row-major.
+       */
+      std::vector <value_type> values_;
+
+
+      /**
+       * @brief
+       * @param first
+       * @param last
+       * @param count
+       * @return
+       */
+      [[nodiscard]] static std::vector <value_type>
+      makeAxis_ (value_type first, value_type last, std::size_t count)
+      {
+        ASSERT (count > 1, "A grid must have at least two columns  &  two rows");
+        ASSERT (first < last, "Coordinates of a grid must ascend");
+
+        std::vector <value_type> axis (count);
+        for (std::size_t index (0); index < count; ++ index)
+        {
+          axis [index] = first + (last - first) * value_type (index) / value_type (count - 1);
+        }
+
+        axis.back () = last;
+
+        return axis;
+      }
+
+
+      /**
+       * @brief Finds the cell of  `coordinate'  along  `axis';  NaN  &  points below the grid go to the first cell,
+       *   points above it go to the last one.
+       * @param coordinate
+       * @param axis
+       * @param scale
+       * @return
+       */
+      [[nodiscard]] static std::size_t
+      locate_ (value_type coordinate, const std::vector <value_type> & axis, value_type scale) noexcept
+      {
+        const value_type position ((coordinate - axis.front ()) * scale);
+        const std::size_t last_cell (axis.size () - 2);
+        if (! (position > value_type (0)))
+        {
+          return 0;
+        }
+
+        if (! (position < value_type (last_cell)))
+        {
+          return last_cell;
+        }
+
+        return std::size_t (position);
+      }
+
+
+      /**
+       * @brief
+       * @param x
+       * @param y
+       * @param cell_column
+       * @param cell_row
+       * @return
+       */
+      [[nodiscard]] value_type
+      interpolate_ (value_type x, value_type y, std::size_t cell_column, std::size_t cell_row) const noexcept
+      {
+        const std::size_t corner (cell_row * xs_.size () + cell_column);
+
+        return lerp_2d (
+          x, y,
+          xs_ [cell_column], xs_ [cell_column + 1], ys_ [cell_row], ys_ [cell_row + 1],
+          values_ [corner], values_ [corner + xs_.size ()], values_ [corner + xs_.size () + 1], values_ [corner + 1]
+        );
+      }
+  };
+}
+
+
+#endif  // UTILS_CONTAINERS_GRID2D_HXX
@@ -0,0 +1,317 @@
+#include "format-date-iso8601.hxx"  // formatDate_Iso8601
+
+#include <cstddef>  // std::size_t
+#include <cstdint>  // std::uint32_t, std::uint64_t
+#include <cstring>  // std::memcpy
+#include <ctime>  // std::{time_t, tm}
+
+#include <chrono>  // std::chrono::seconds
+#include <limits>  // std::numeric_limits
+#include <tuple>  // std::tie
+
+#include <time.h>  // ::{gmtime_r, localtime_r}
+
+#include "../algorithms/max.hxx"  // max
+#include "../algorithms/to-chars.hxx"  // toCharsFixed
+#include "../config/format-date-iso8601.hxx"  // Config::Utils::FormatDate_Iso8601::Offset_refresh_interval
+#include "time-utils.hxx"  // civilFromDays, tmDiff
+
+
+namespace Utils
+{
+  namespace
+  {
+    /**
+     * @brief Length of  `-MM-DDThh:mm:ss'.
+     */
+    constexpr std::size_t Date_time_tail_size (15);
+
+    /**
+     * @brief Length of the longest year,  i. e. a sign  &  the 12 digits of the years of all 64-bit  `std::time_t'.
+     */
+    constexpr std::size_t Max_year_size (13);
+
+    /**
+     * @brief Length of  `YYYY-MM-DDThh:mm:ss'  with the longest year.
+     */
+    constexpr std::size_t Max_date_time_size (Max_year_size + Date_time_tail_size);
+
+    /**
+     * @brief Minimal number of digits of an expanded year,  as in ECMAScript  `Date.prototype.toISOString'.
+     */
+    constexpr std::size_t Expanded_year_min_digits (6);
+
+    /**
+     * @brief Length of  `+hh:mm'.
+     */
+    constexpr std::size_t Max_offset_size (6);
+
+    /**
+     * @brief
+     */
+    constexpr std::time_t Seconds_per_day (24 * 60 * 60);
+
+    /**
+     * @brief
+     */
+    constexpr std::time_t Offset_refresh_interval (
+      std::chrono::seconds (Config::Utils::FormatDate_Iso8601::Offset_refresh_interval).count ()
+    );
+
+    /**
+     * @brief
+     */
+    constexpr std::uint32_t Fraction_divisors [] {
+      1'000'000'000, 100'000'000, 10'000'000, 1'000'000, 100'000, 10'000, 1'000, 100, 10, 1
+    };
+
+
+    /**
+     * @brief Per-thread rendering state.
+     */
+    struct Cache final
+    {
+      /**
+       * @brief Whether  `time'  &  the offset fields are set.
+       */
+      bool is_valid { false };
+
+      /**
+       * @brief Second rendered into  `date_time'.
+       */
+      std::time_t time { };
+
+      /**
+       * @brief First second for which  `offset'  is valid.
+       */
+      std::time_t offset_valid_from { };
+
+      /**
+       * @brief Last second for which  `offset'  is valid,  inclusive so it can't overflow.
+       */
+      std::time_t offset_valid_last { };
+
+      /**
+       * @brief UTC offset in seconds.
+       */
+      std::time_t offset_in_seconds { };
+
+      /**
+       * @brief
+       */
+      char date_time [Max_date_time_size] { };
+
+      /**
+       * @brief
+       */
+      std::size_t date_time_size { };
+
+      /**
+       * @brief Either  `Z'  or  `+hh:mm'.
+       */
+      char offset [Max_offset_size] { };
+
+      /**
+       * @brief
+       */
+      std::size_t offset_size { };
+    };
+
+
+    /**
+     * @brief
+     */
+    thread_local Cache cache;
+
+
+    /**
+     * @brief
+     * @param x
+     * @param y
+     * @return  `x / y'  rounded towards negative infinity.
+     */
+    constexpr std::time_t
+    floorDivide (std::time_t x, std::time_t y) noexcept
+    {
+      return x / y - ((x % y) < 0);
+    }
+
+
+    /**
+     * @brief
+     * @param x
+     * @param y Positive.
+     * @return  `x - floorDivide (x, y) * y',  i. e. in  [0; y),  without overflowing.
+     */
+    constexpr std::time_t
+    floorModulo (std::time_t x, std::time_t y) noexcept
+    {
+      const std::time_t remainder (x % y);
+
+      return (remainder < 0) ? (remainder + y) : remainder;
+    }
+
+
+    /**
+     * @brief
+     * @param time
+     * @return UTC offset of  `time'  in seconds,  or  0  if it isn't a whole number of minutes  (local mean time
+     *   offsets like  +00:19:32  can't be written in ISO 8601,  so such times are written in UTC)  or unknown.
+     */
+    int
+    offsetAt (std::time_t time) noexcept
+    {
+      std::tm local_tm { };
+      std::tm utc_tm { };
+      if ((::localtime_r (& time, & local_tm) == nullptr) || (::gmtime_r (& time, & utc_tm) == nullptr))
+      {
+        return 0;
+      }
+
+      const int offset_in_seconds (tmDiff (local_tm, utc_tm));
+
+      return (offset_in_seconds % 60 == 0) ? offset_in_seconds : 0;
+    }
+
+
+    /**
+     * @brief Caches the offset of  `time'  for its  `Offset_refresh_interval',  unless the offset changes within
+     *   that interval:  then only for  `time'  itself.
+     * @param time
+     */
+    void
+    refreshOffset (std::time_t time) noexcept
+    {
+      const int offset_in_seconds (offsetAt (time));
+      cache.offset_in_seconds = offset_in_seconds;
+      // The interval containing  `time',  clamped to the range of  `std::time_t'.
+      const std::time_t before (floorModulo (time, Offset_refresh_interval));
+      const std::time_t after (Offset_refresh_interval - 1 - before);
+      cache.offset_valid_from = (time < std::numeric_limits <std::time_t>::min () + before)
+        ? std::numeric_limits <std::time_t>::min ()
+        : (time - before);
+      cache.offset_valid_last = (time > std::numeric_limits <std::time_t>::max () - after)
+        ? std::numeric_limits <std::time_t>::max ()
+        : (time + after);
+      if (
+        (offsetAt (cache.offset_valid_from) != offset_in_seconds)
+        || (offsetAt (cache.offset_valid_last) != offset_in_seconds)
+      )
+      {
+        cache.offset_valid_from = time;
+        cache.offset_valid_last = time;
+      }
+
+      if (offset_in_seconds == 0)
+      {
+        cache.offset [0] = 'Z';
+        cache.offset_size = 1;
+      }
+      else
+      {
+        const int offset_in_minutes (((offset_in_seconds < 0) ? (- offset_in_seconds) : offset_in_seconds) / 60);
+        cache.offset [0] = (offset_in_seconds < 0) ? '-' : '+';
+        toCharsFixed (cache.offset + 1, std::uint64_t (offset_in_minutes / 60), 2);
+        cache.offset [3] = ':';
+        toCharsFixed (cache.offset + 4, std::uint64_t (offset_in_minutes % 60), 2);
+        cache.offset_size = Max_offset_size;
+      }
+    }
+
+
+    /**
+     * @brief Writes  `year'  as  `YYYY'  if it's in  [0; 9999],  otherwise in the expanded representation,  i. e.
+     *   its sign  &  at least  `Expanded_year_min_digits'  digits.
+     * @param first
+     * @param year
+     * @return Pointer past the last written character.
+     */
+    char *
+    writeYear (char * first, long year) noexcept
+    {
+      if ((year >= 0) && (year <= 9'999))
+      {
+        return toCharsFixed (first, std::uint64_t (year), 4);
+      }
+
+      const std::uint64_t absolute_year ((year < 0) ? (std::uint64_t (0) - std::uint64_t (year)) : std::uint64_t (year));
+      std::size_t digits (1);
+      for (std::uint64_t rest (absolute_year / 10); rest != 0; rest /= 10)
+      {
+        ++ digits;
+      }
+
+      * first = (year < 0) ? '-' : '+';
+
+      return toCharsFixed (first + 1, absolute_year, max (digits, Expanded_year_min_digits));
+    }
+
+
+    /**
+     * @brief
+     * @param time
+     */
+    void
+    refreshDateTime (std::time_t time) noexcept
+    {
+      // The offset is only non-zero where  `::localtime_r'  succeeds,  i. e. far from the ends of  `std::time_t'.
+      const std::time_t local_time (time + cache.offset_in_seconds);
+      const std::time_t days (floorDivide (local_time, Seconds_per_day));
+      const std::time_t seconds_of_day (floorModulo (local_time, Seconds_per_day));
+
+      long year;
+      int month;
+      int day;
+      std::tie (year, month, day) = civilFromDays (long (days));
+
+      char * const tail (writeYear (cache.date_time, year));
+      tail [0] = '-';
+      toCharsFixed (tail + 1, std::uint64_t (month), 2);
+      tail [3] = '-';
+      toCharsFixed (tail + 4, std::uint64_t (day), 2);
+      tail [6] = 'T';
+      toCharsFixed (tail + 7, std::uint64_t (seconds_of_day / (60 * 60)), 2);
+      tail [9] = ':';
+      toCharsFixed (tail + 10, std::uint64_t (seconds_of_day / 60 % 60), 2);
+      tail [12] = ':';
+      toCharsFixed (tail + 13, std::uint64_t (seconds_of_day % 60), 2);
+      cache.date_time_size = std::size_t (tail - cache.date_time) + Date_time_tail_size;
+
+      cache.time = time;
+    }
+  }
+
+
+  char *
+  formatDate_Iso8601 (std::time_t time, std::uint32_t nanoseconds, std::size_t fraction_digits, char * first) noexcept
+  {
+    if (! cache.is_valid || (time != cache.time))
+    {
+      if (! cache.is_valid || (time < cache.offset_valid_from) || (time > cache.offset_valid_last))
+      {
+        refreshOffset (time);
+      }
+
+      refreshDateTime (time);
+      cache.is_valid = true;
+    }
+
+    std::memcpy (first, cache.date_time, cache.date_time_size);
+    first += cache.date_time_size;
+
+    if (fraction_digits > 0)
+    {
+      if (fraction_digits > 9)
+      {
+        fraction_digits = 9;
+      }
+
+      * first = '.';
+      first = toCharsFixed (first + 1, nanoseconds / Fraction_divisors [fraction_digits], fraction_digits);
+    }
+
+    std::memcpy (first, cache.offset, cache.offset_size);
+
+    return first + cache.offset_size;
+  }
+}
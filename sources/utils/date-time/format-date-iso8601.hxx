@@ -2,79 +2,83 @@
 #define UTILS_DATETIME_FORMATDDATEISO8601_HXX
 
 
-#include <ctime>  // std::{gmtime, localtime, time_t, tm}
+#include <cstddef>  // std::size_t
+#include <cstdint>  // std::uint32_t
+#include <ctime>  // std::time_t
 
+#include <chrono>  // std::chrono::{duration_cast, nanoseconds}
 #include <string>  // std::string
 
-#include <fmt/format.h>  // fmt::MemoryWriter
-#include <fmt/time.h>  // fmt::MemoryWriter::print[std::tm]
-
 
 namespace Utils
 {
+  /**
+   * @brief Maximal length of a date written by  `formatDate_Iso8601',  i. e.  `YYYY-MM-DDThh:mm:ss.nnnnnnnnn+hh:mm'
+   *   with a 13-character expanded year  (the years of all 64-bit  `std::time_t').
+   */
+  inline constexpr std::size_t Date_Iso8601_max_size (44);
+
+
+  /**
+   * @brief Writes  `time'  as a local ISO 8601 date with UTC offset to  `first'.
+   * Neither allocates nor locks:  the UTC offset is cached per thread  &  refreshed at quarter-hour boundaries
+   *   (see  `Config::Utils::FormatDate_Iso8601::Offset_refresh_interval'),  the date  &  time of day are rendered
+   *   once per second,  so consecutive calls only rewrite the fractional digits.
+   * Years outside  [0; 9999]  are written in the expanded representation,  e. g.  `-000001'  or  `+010000'.
+   * Times whose UTC offset isn't a whole number of minutes  (historical local mean time)  are written in UTC.
+   * @param time Seconds since the Epoch.
+   * @param nanoseconds Fraction of the second,  [0; 1'000'000'000).
+   * @param fraction_digits Number of fractional digits to write,  [0; 9];  if  0,  the decimal point is omitted.
+   * @param first Buffer of at least  `Date_Iso8601_max_size'  characters.
+   * @return Pointer past the last written character.
+   */
+  char *
+  formatDate_Iso8601 (std::time_t time, std::uint32_t nanoseconds, std::size_t fraction_digits, char * first) noexcept;
+
+
   /**
    * @brief
    * @tparam TClock
    * @param now
-   * @return
+   * @param first Buffer of at least  `Date_Iso8601_max_size'  characters.
+   * @param fraction_digits Number of fractional digits to write,  [0; 9].
+   * @return Pointer past the last written character.
    */
   template <typename TClock>
-  [[nodiscard]] std::string
-  formatDate_Iso8601 (const typename TClock::time_point & now)
+  char *
+  formatDate_Iso8601 (const typename TClock::time_point & now, char * first, std::size_t fraction_digits = 0) noexcept
   {
     using clock_type = TClock;
 
 
-    const std::time_t now_as_time_t (clock_type::to_time_t (now));
-    const std::tm now_as_local_tm (* std::localtime (& now_as_time_t));
-    const std::tm now_as_utc_tm (* std::gmtime (& now_as_time_t));
-
-    int time_diff_in_seconds (
-        60 * (
-            60 * (now_as_local_tm.tm_hour - now_as_utc_tm.tm_hour)
-          +      (now_as_local_tm.tm_min  - now_as_utc_tm.tm_min )
-        )
-      + (now_as_local_tm.tm_sec - now_as_utc_tm.tm_sec)
+    std::time_t time (clock_type::to_time_t (now));
+    std::chrono::nanoseconds::rep nanoseconds (
+      std::chrono::duration_cast <std::chrono::nanoseconds> (now - clock_type::from_time_t (time)).count ()
     );
-    const int date_diff_in_days (now_as_local_tm.tm_mday - now_as_utc_tm.tm_mday);  // - 1,  0  or  1.
-
-    if ((date_diff_in_days == 1) || (date_diff_in_days < (- 1)))
-    {
-      time_diff_in_seconds += 24 * 60 * 60;
-    }
-    else
+    if (nanoseconds < 0)
     {
-      if ((date_diff_in_days == (- 1)) || (date_diff_in_days > 1))
-      {
-        time_diff_in_seconds -= 24 * 60 * 60;
-      }
+      -- time;
+      nanoseconds += 1'000'000'000;
     }
 
-    if (now_as_local_tm.tm_isdst == 1) {
-      if (time_diff_in_seconds >= 0)
-      {
-        time_diff_in_seconds += 60 * 60;
-      }
-      else
-      {
-        time_diff_in_seconds -= 60 * 60;
-      }
-    }
+    return formatDate_Iso8601 (time, std::uint32_t (nanoseconds), fraction_digits, first);
+  }
 
-    fmt::MemoryWriter memory_writer;
-    memory_writer.write ("{0:%Y-%m-%dT%H:%M:%S}", now_as_local_tm);
-    if (time_diff_in_seconds == 0)
-    {
-      memory_writer.write ("Z");
-    }
-    else
-    {
-      const int time_diff_hours (time_diff_in_seconds / 60 / 60);
-      const int time_diff_minutes ((time_diff_in_seconds - time_diff_hours * 60 * 60) / 60);
-      memory_writer.write ("{0:0=+3d}:{1:0>2d}", time_diff_hours, time_diff_minutes);
-    }
 
-    return memory_writer.str ();
+  /**
+   * @brief
+   * @tparam TClock
+   * @param now
+   * @return
+   */
+  template <typename TClock>
+  [[nodiscard]] std::string
+  formatDate_Iso8601 (const typename TClock::time_point & now)
+  {
+    char buffer [Date_Iso8601_max_size];
+    const char * const last (formatDate_Iso8601 <TClock> (now, buffer));
+
+    return std::string (buffer, std::size_t (last - buffer));
   }
 }
 
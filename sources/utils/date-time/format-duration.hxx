@@ -2,84 +2,124 @@
 #define UTILS_DATETIME_FORMATDURATION_HXX
 
 
-#include <chrono>  // std::chrono::{duration_cast, milliseconds, minutes, seconds}
+#include <cstddef>  // std::size_t
+#include <cstdint>  // std::uint64_t
+#include <cstring>  // std::memcpy
+
+#include <chrono>  // std::chrono::{duration_cast, nanoseconds}
 #include <string>  // std::string
 
-#include <fmt/format.h>  // fmt::MemoryWriter
+#include "../algorithms/to-chars.hxx"  // toChars
 
 
 namespace Utils
 {
   /**
-   * @brief
-   * TODO:  [0;1]  Make code as short  &  clean as possible.
-   * @param duration
-   * @return
+   * @brief Maximal length of a duration written by  `formatDuration',
+   *   i. e.  `-2562047h 47min 16s 854ms 775us 808ns'.
    */
-  template <typename TDuration>
-  [[nodiscard]] std::string
-  formatDuration (TDuration duration)
-  {
-    using namespace std::chrono;
+  inline constexpr std::size_t Duration_max_size (40);
 
-    using namespace std::chrono_literals;
 
-
-    fmt::MemoryWriter memory_writer;
-    bool is_first (true);
-
-    const hours duration_hours (duration_cast <hours> (duration));
-    if (duration_hours != 0h)
+  namespace FormatDurationInternals_
+  {
+    /**
+     * @brief
+     */
+    struct Unit_ final
     {
-      memory_writer.write ("{0:d}h", duration_hours.count ());
-      is_first = false;
-    }
+      /**
+       * @brief
+       */
+      std::uint64_t nanoseconds;
+
+      /**
+       * @brief
+       */
+      const char * suffix;
+
+      /**
+       * @brief
+       */
+      std::size_t suffix_size;
+    };
+
+
+    /**
+     * @brief
+     */
+    inline constexpr Unit_ Units_ [] {
+      { 3'600'000'000'000, "h", 1 },
+      { 60'000'000'000, "min", 3 },
+      { 1'000'000'000, "s", 1 },
+      { 1'000'000, "ms", 2 },
+      { 1'000, "us", 2 },
+      { 1, "ns", 2 }
+    };
+  }
 
-    const minutes duration_minutes (duration_cast <minutes> (duration - duration_hours));
-    if (duration_minutes != 0min)
-    {
-      memory_writer.write ("{0:s}{1:d}min", ((is_first) ? "" : " "), duration_minutes.count ());
-      is_first = false;
-    }
 
-    const seconds duration_seconds (duration_cast <seconds> (duration - duration_hours - duration_minutes));
-    if (duration_seconds != 0s)
+  /**
+   * @brief Writes  `duration'  as  `1h 2min 3s 4ms 5us 6ns'  to  `first',  omitting zero components
+   *   (zero duration is written as an empty string).
+   * Converts to nanoseconds once  &  splits with integer divisions,  never allocates.
+   * @tparam TDuration
+   * @param duration
+   * @param first Buffer of at least  `Duration_max_size'  characters.
+   * @return Pointer past the last written character.
+   */
+  template <typename TDuration>
+  char *
+  formatDuration (TDuration duration, char * first) noexcept
+  {
+    const std::chrono::nanoseconds::rep count (std::chrono::duration_cast <std::chrono::nanoseconds> (duration).count ());
+    std::uint64_t rest ((std::uint64_t (count)));
+    if (count < 0)
     {
-      memory_writer.write ("{0:s}{1:d}s", ((is_first) ? "" : " "), duration_seconds.count ());
-      is_first = false;
+      * first = '-';
+      ++ first;
+      rest = 0 - rest;
     }
 
-    const milliseconds duration_milliseconds (
-      duration_cast <milliseconds> (duration - duration_hours - duration_minutes - duration_seconds)
-    );
-    if (duration_milliseconds != 0ms)
+    bool is_first (true);
+    for (const FormatDurationInternals_::Unit_ & unit : FormatDurationInternals_::Units_)
     {
-      memory_writer.write ("{0:s}{1:d}ms", ((is_first) ? "" : " "), duration_milliseconds.count ());
-      is_first = false;
+      const std::uint64_t quotient (rest / unit.nanoseconds);
+      rest -= quotient * unit.nanoseconds;
+
+      if (quotient != 0)
+      {
+        if (! is_first)
+        {
+          * first = ' ';
+          ++ first;
+        }
+
+        first = toChars (first, quotient);
+        std::memcpy (first, unit.suffix, unit.suffix_size);
+        first += unit.suffix_size;
+        is_first = false;
+      }
     }
 
-    const microseconds duration_microseconds (
-      duration_cast <microseconds> (
-        duration - duration_hours - duration_minutes - duration_seconds - duration_milliseconds
-      )
-    );
-    if (duration_microseconds != 0us)
-    {
-      memory_writer.write ("{0:s}{1:d}us", ((is_first) ? "" : " "), duration_microseconds.count ());
-      is_first = false;
-    }
+    return first;
+  }
 
-    const nanoseconds duration_nanoseconds (
-      duration_cast <nanoseconds> (
-        duration - duration_hours - duration_minutes - duration_seconds - duration_milliseconds - duration_microseconds
-      )
-    );
-    if (duration_nanoseconds != 0ns)
-    {
-      memory_writer.write ("{0:s}{1:d}ns", ((is_first) ? "" : " "), duration_nanoseconds.count ());
-    }
 
-    return memory_writer.str ();
+  /**
+   * @brief
+   * @tparam TDuration
+   * @param duration
+   * @return
+   */
+  template <typename TDuration>
+  [[nodiscard]] std::string
+  formatDuration (TDuration duration)
+  {
+    char buffer [Duration_max_size];
+    const char * const last (formatDuration (duration, buffer));
+
+    return std::string (buffer, std::size_t (last - buffer));
   }
 }
 
@@ -0,0 +1,955 @@
+#include "profiler.hxx"  // Profiler::*,  ProfilerScope::*
+
+#include <cstddef>  // std::size_t
+#include <cstdint>  // std::{int64_t, uint8_t, uint64_t}
+#include <cstdlib>  // std::atexit
+
+#include <algorithm>  // std::{find_if, max, min, sort}
+#include <atomic>  // std::{atomic, memory_order_*}
+#include <chrono>  // std::chrono::{duration_cast, nanoseconds}
+#include <fstream>  // std::ofstream
+#include <iostream>  // std::clog
+#include <limits>  // std::numeric_limits
+#include <memory>  // std::{make_unique, unique_ptr}
+#include <mutex>  // std::{lock_guard, mutex}
+#include <new>  // std::nothrow
+#include <ostream>  // std::ostream
+#include <string>  // std::string
+#include <utility>  // std::move
+#include <vector>  // std::vector
+
+#include <fmt/format.h>  // fmt::format
+#include <fmt/ostream.h>  // fmt::print[std::ostream]
+
+#include "../algorithms/bit-width.hxx"  // bitWidth
+#include "../config/profiler.hxx"  // Config::Utils::Profiler::*
+#include "../containers/c-string.hxx"  // CString
+
+
+namespace Utils
+{
+  namespace
+  {
+    /**
+     * @brief
+     */
+    constexpr std::size_t max_nodes (Config::Utils::Profiler::Max_nodes);
+
+    /**
+     * @brief
+     */
+    constexpr std::size_t sub_buckets_log2 (Config::Utils::Profiler::Histogram_sub_buckets_log2);
+
+    /**
+     * @brief
+     */
+    constexpr std::size_t sub_buckets (std::size_t (1) << sub_buckets_log2);
+
+    /**
+     * @brief
+     */
+    constexpr std::size_t buckets ((Config::Utils::Profiler::Histogram_octaves + 1) * sub_buckets);
+
+    /**
+     * @brief
+     */
+    constexpr std::size_t trace_chunk_size (Config::Utils::Profiler::Trace_chunk_size);
+
+    static_assert (Config::Utils::Profiler::Trace_capacity % trace_chunk_size == 0);
+
+    /**
+     * @brief
+     */
+    constexpr std::size_t trace_chunks (Config::Utils::Profiler::Trace_capacity / trace_chunk_size);
+
+
+    /**
+     * @brief Log-linear bucket of  `value':  values are split into octaves,  each octave into  `sub_buckets'  equal
+     *   parts,  so the relative error is bounded by  `1 / sub_buckets'.
+     * @param value
+     * @return
+     */
+    std::size_t
+    bucketOf (std::uint64_t value) noexcept
+    {
+      if (value < sub_buckets)
+      {
+        return std::size_t (value);
+      }
+
+      const std::size_t msb (std::size_t (bitWidth (value) - 1));
+      const std::size_t octave (msb - sub_buckets_log2 + 1);
+      const std::size_t bucket (
+        octave * sub_buckets + std::size_t ((value >> (msb - sub_buckets_log2)) & (sub_buckets - 1))
+      );
+
+      return (bucket < buckets) ? bucket : (buckets - 1);
+    }
+
+
+    /**
+     * @brief
+     * @param bucket
+     * @return
+     */
+    std::uint64_t
+    bucketLowerBound (std::size_t bucket) noexcept
+    {
+      if (bucket < sub_buckets)
+      {
+        return bucket;
+      }
+
+      const std::size_t octave (bucket / sub_buckets);
+
+      return std::uint64_t (sub_buckets + bucket % sub_buckets) << (octave - 1);
+    }
+
+
+    /**
+     * @brief Adds  `value'  to a counter that only the owning thread writes to.
+     * Readers on other threads see either the old or the new value.
+     * @param counter
+     * @param value
+     */
+    void
+    add (std::atomic <std::uint64_t> & counter, std::uint64_t value) noexcept
+    {
+      counter.store (counter.load (std::memory_order_relaxed) + value, std::memory_order_relaxed);
+    }
+
+
+    /**
+     * @brief Node of a per-thread call tree.
+     */
+    struct Node final
+    {
+      /**
+       * @brief
+       */
+      const ProfilerSite * site { };
+
+      /**
+       * @brief Immutable once the node is published.
+       */
+      std::size_t parent { };
+
+      /**
+       * @brief Owner-only.
+       */
+      std::size_t first_child { max_nodes };
+
+      /**
+       * @brief Owner-only.
+       */
+      std::size_t next_sibling { max_nodes };
+
+      /**
+       * @brief
+       */
+      std::atomic <std::uint64_t> count { };
+
+      /**
+       * @brief
+       */
+      std::atomic <std::uint64_t> total { };
+
+      /**
+       * @brief
+       */
+      std::atomic <std::uint64_t> minimum { std::numeric_limits <std::uint64_t>::max () };
+
+      /**
+       * @brief
+       */
+      std::atomic <std::uint64_t> maximum { };
+
+      /**
+       * @brief
+       */
+      std::atomic <std::uint64_t> histogram [buckets] { };
+
+
+      /**
+       * @brief
+       */
+      void
+      reset () noexcept
+      {
+        site = nullptr;
+        parent = 0;
+        first_child = max_nodes;
+        next_sibling = max_nodes;
+        count.store (0, std::memory_order_relaxed);
+        total.store (0, std::memory_order_relaxed);
+        minimum.store (std::numeric_limits <std::uint64_t>::max (), std::memory_order_relaxed);
+        maximum.store (0, std::memory_order_relaxed);
+        for (std::atomic <std::uint64_t> & bucket : histogram)
+        {
+          bucket.store (0, std::memory_order_relaxed);
+        }
+      }
+    };
+
+
+    /**
+     * @brief
+     */
+    struct Event final
+    {
+      /**
+       * @brief
+       */
+      std::size_t node;
+
+      /**
+       * @brief
+       */
+      std::int64_t time_started;
+
+      /**
+       * @brief
+       */
+      std::uint64_t time_elapsed;
+    };
+
+
+    /**
+     * @brief Event of an exited thread.
+     */
+    struct RetiredEvent final
+    {
+      /**
+       * @brief
+       */
+      const ProfilerSite * site;
+
+      /**
+       * @brief
+       */
+      std::size_t thread_index;
+
+      /**
+       * @brief
+       */
+      std::int64_t time_started;
+
+      /**
+       * @brief
+       */
+      std::uint64_t time_elapsed;
+    };
+
+
+    /**
+     * @brief Everything one thread has recorded.
+     * Node  `0'  is the root of the call tree.  Trace events are allocated in chunks on demand,  so threads that
+     *   record few events don't pay for  `Trace_capacity'.
+     */
+    struct ThreadData final
+    {
+      /**
+       * @brief
+       */
+      std::size_t index { };
+
+      /**
+       * @brief Owner-only.
+       */
+      std::size_t current_node { };
+
+      /**
+       * @brief
+       */
+      std::atomic <std::size_t> nodes_count { 1 };
+
+      /**
+       * @brief
+       */
+      std::atomic <std::size_t> events_count { };
+
+      /**
+       * @brief Events not recorded because the trace was full.
+       */
+      std::atomic <std::uint64_t> events_dropped { };
+
+      /**
+       * @brief
+       */
+      const std::unique_ptr <Node []> nodes { new Node [max_nodes] };
+
+      /**
+       * @brief Owner-only but for the chunks below  `events_count'.
+       */
+      std::unique_ptr <Event []> event_chunks [trace_chunks];
+
+
+      /**
+       * @brief
+       * @param event_index Less than  `events_count'.
+       * @return
+       */
+      [[nodiscard]] const Event &
+      event (std::size_t event_index) const noexcept
+      {
+        return event_chunks [event_index / trace_chunk_size] [event_index % trace_chunk_size];
+      }
+
+
+      /**
+       * @brief Clears everything recorded,  keeps the allocated event chunks.
+       */
+      void
+      reset () noexcept
+      {
+        const std::size_t count (nodes_count.load (std::memory_order_relaxed));
+        for (std::size_t node (0); node < count; ++ node)
+        {
+          nodes [node].reset ();
+        }
+
+        current_node = 0;
+        nodes_count.store (1, std::memory_order_relaxed);
+        events_count.store (0, std::memory_order_relaxed);
+        events_dropped.store (0, std::memory_order_relaxed);
+      }
+    };
+
+
+    /**
+     * @brief
+     */
+    std::mutex registry_mutex;
+
+    /**
+     * @brief Data of the running threads.
+     */
+    std::vector <std::unique_ptr <ThreadData>> registry;
+
+    /**
+     * @brief Call trees of the exited threads,  merged.
+     */
+    std::unique_ptr <ThreadData> exited_data;
+
+    /**
+     * @brief Data of the exited threads,  ready to be reused.
+     */
+    std::vector <std::unique_ptr <ThreadData>> free_data;
+
+    /**
+     * @brief Trace events of the exited threads,  at most  `Trace_capacity'.
+     */
+    std::vector <RetiredEvent> retired_events;
+
+    /**
+     * @brief Trace events of the exited threads that didn't fit  `retired_events'  or their thread's trace.
+     */
+    std::uint64_t retired_events_dropped { };
+
+    /**
+     * @brief
+     */
+    std::size_t threads_count { };
+
+    /**
+     * @brief
+     */
+    thread_local ThreadData * thread_data { };
+
+    /**
+     * @brief Whether the calling thread has already retired its data,  i. e. is exiting.
+     */
+    thread_local bool is_thread_data_retired { };
+
+    /**
+     * @brief
+     */
+    const char * exit_trace_path { };
+
+
+    /**
+     * @brief Adds the call tree of  `source'  to the one of  `target',  node by node.
+     * Must be called with  `registry_mutex'  held;  nodes that don't fit  `target'  are skipped.
+     * @param target
+     * @param source
+     * @param node_map Scratch space of  `max_nodes'  indices.
+     */
+    void
+    mergeTree (ThreadData & target, const ThreadData & source, std::vector <std::size_t> & node_map) noexcept
+    {
+      Node * const nodes (target.nodes.get ());
+      const std::size_t source_count (source.nodes_count.load (std::memory_order_acquire));
+      node_map [0] = 0;
+      // Parents are always created before their children:
+      for (std::size_t index (1); index < source_count; ++ index)
+      {
+        const Node & node (source.nodes [index]);
+        const std::size_t parent (node_map [node.parent]);
+        node_map [index] = max_nodes;
+        if (parent == max_nodes)
+        {
+          continue;
+        }
+
+        std::size_t child (nodes [parent].first_child);
+        while ((child != max_nodes) && (nodes [child].site != node.site))
+        {
+          child = nodes [child].next_sibling;
+        }
+
+        if (child == max_nodes)
+        {
+          child = target.nodes_count.load (std::memory_order_relaxed);
+          if (child == max_nodes)
+          {
+            continue;
+          }
+
+          nodes [child].site = node.site;
+          nodes [child].parent = parent;
+          nodes [child].next_sibling = nodes [parent].first_child;
+          nodes [parent].first_child = child;
+          target.nodes_count.store (child + 1, std::memory_order_release);
+        }
+
+        node_map [index] = child;
+        Node & merged (nodes [child]);
+        add (merged.count, node.count.load (std::memory_order_relaxed));
+        add (merged.total, node.total.load (std::memory_order_relaxed));
+        merged.minimum.store (
+          std::min (merged.minimum.load (std::memory_order_relaxed), node.minimum.load (std::memory_order_relaxed)),
+          std::memory_order_relaxed
+        );
+        merged.maximum.store (
+          std::max (merged.maximum.load (std::memory_order_relaxed), node.maximum.load (std::memory_order_relaxed)),
+          std::memory_order_relaxed
+        );
+        for (std::size_t bucket (0); bucket < buckets; ++ bucket)
+        {
+          add (merged.histogram [bucket], node.histogram [bucket].load (std::memory_order_relaxed));
+        }
+      }
+    }
+
+
+    /**
+     * @brief Merges the data of the calling thread into  `exited_data'  &  `retired_events'  &  recycles it.
+     */
+    void
+    retireThreadData () noexcept
+    {
+      is_thread_data_retired = true;
+      ThreadData * const data (thread_data);
+      if (data == nullptr)
+      {
+        return;
+      }
+
+      try
+      {
+        const std::lock_guard <std::mutex> registry_lock (registry_mutex);
+        if (exited_data == nullptr)
+        {
+          exited_data = std::make_unique <ThreadData> ();
+        }
+
+        std::vector <std::size_t> node_map (max_nodes);
+        free_data.reserve (free_data.size () + 1);
+        retired_events.reserve (Config::Utils::Profiler::Trace_capacity);
+
+        thread_data = nullptr;
+        mergeTree (* exited_data, * data, node_map);
+
+        const std::size_t events_count (data->events_count.load (std::memory_order_relaxed));
+        for (std::size_t index (0); index < events_count; ++ index)
+        {
+          if (! (retired_events.size () < Config::Utils::Profiler::Trace_capacity))
+          {
+            retired_events_dropped += events_count - index;
+
+            break;
+          }
+
+          const Event & event (data->event (index));
+          retired_events.push_back (
+            RetiredEvent { data->nodes [event.node].site, data->index, event.time_started, event.time_elapsed }
+          );
+        }
+
+        retired_events_dropped += data->events_dropped.load (std::memory_order_relaxed);
+
+        const auto found (
+          std::find_if (
+            registry.begin (), registry.end (),
+            [data] (const std::unique_ptr <ThreadData> & registered)
+            {
+              return registered.get () == data;
+            }
+          )
+        );
+        free_data.push_back (std::move (* found));
+        registry.erase (found);
+      }
+      catch (...)
+      {
+        // Out of memory:  the data stays registered as is.
+      }
+    }
+
+
+    /**
+     * @brief Retires the data of its thread on thread exit.
+     */
+    struct ThreadDataOwner final
+    {
+      /**
+       * @brief
+       */
+      ~ ThreadDataOwner ()
+      {
+        retireThreadData ();
+      }
+    };
+
+
+    /**
+     * @brief
+     * @return  `nullptr'  if the calling thread has already retired its data.
+     */
+    ThreadData *
+    threadData ()
+    {
+      if ((thread_data == nullptr) && (! is_thread_data_retired))
+      {
+        // Scopes of the thread-locals destroyed after it aren't recorded,  see  `is_thread_data_retired'.
+        thread_local ThreadDataOwner owner;
+
+        const std::lock_guard <std::mutex> registry_lock (registry_mutex);
+        registry.reserve (registry.size () + 1);
+        if (free_data.empty ())
+        {
+          registry.push_back (std::make_unique <ThreadData> ());
+        }
+        else
+        {
+          registry.push_back (std::move (free_data.back ()));
+          free_data.pop_back ();
+          registry.back ()->reset ();
+        }
+
+        ++ threads_count;
+        registry.back ()->index = threads_count;
+        thread_data = registry.back ().get ();
+      }
+
+      return thread_data;
+    }
+
+
+    /**
+     * @brief
+     * @param site
+     * @return
+     */
+    [[nodiscard]] const char *
+    nameOf (const ProfilerSite & site) noexcept
+    {
+      return site.description ().data ();
+    }
+
+
+    /**
+     * @brief
+     * @param output
+     * @param string
+     */
+    void
+    writeJsonString (std::ostream & output, const char * string)
+    {
+      output << '"';
+      for (; * string != '\0'; ++ string)
+      {
+        const char character (* string);
+        if ((character == '"') || (character == '\\'))
+        {
+          output << '\\' << character;
+        }
+        else if (std::uint8_t (character) < 0x20)
+        {
+          fmt::print (output, "\\u{0:04x}", unsigned (character));
+        }
+        else
+        {
+          output << character;
+        }
+      }
+
+      output << '"';
+    }
+
+
+    /**
+     * @brief Statistics of one site merged over all nodes  &  threads.
+     */
+    struct SiteTotals final
+    {
+      /**
+       * @brief
+       */
+      const ProfilerSite * site { };
+
+      /**
+       * @brief
+       */
+      std::uint64_t count { };
+
+      /**
+       * @brief
+       */
+      std::uint64_t total { };
+
+      /**
+       * @brief
+       */
+      std::uint64_t minimum { std::numeric_limits <std::uint64_t>::max () };
+
+      /**
+       * @brief
+       */
+      std::uint64_t maximum { };
+
+      /**
+       * @brief
+       */
+      std::uint64_t histogram [buckets] { };
+
+
+      /**
+       * @brief
+       * @param fraction
+       * @return
+       */
+      [[nodiscard]] std::uint64_t
+      percentile (double fraction) const noexcept
+      {
+        const double rank (fraction * double (count));
+        std::uint64_t seen (0);
+        for (std::size_t bucket (0); bucket < buckets; ++ bucket)
+        {
+          seen += histogram [bucket];
+          if (! (double (seen) < rank))
+          {
+            return bucketLowerBound (bucket);
+          }
+        }
+
+        return maximum;
+      }
+    };
+
+
+    /**
+     * @brief
+     * @param output
+     * @param data
+     * @param parent
+     * @param nodes_count
+     * @param depth
+     */
+    void
+    writeTree (std::ostream & output, const ThreadData & data, std::size_t parent, std::size_t nodes_count, std::size_t depth)
+    {
+      for (std::size_t index (1); index < nodes_count; ++ index)
+      {
+        const Node & node (data.nodes [index]);
+        if (node.parent != parent)
+        {
+          continue;
+        }
+
+        fmt::print (
+          output, "{0:>12d} {1:>16d}  {2:s}{3:s}\n",
+          node.count.load (std::memory_order_relaxed), node.total.load (std::memory_order_relaxed),
+          std::string (2 * depth, ' '), nameOf (* node.site)
+        );
+        writeTree (output, data, index, nodes_count, depth + 1);
+      }
+    }
+
+
+    /**
+     * @brief
+     */
+    void
+    writeReportsAtExit ()
+    {
+      Profiler::writeSummary (std::clog);
+
+      std::ofstream trace (exit_trace_path);
+      Profiler::writeTrace (trace);
+    }
+  }
+
+
+  ProfilerScope::ProfilerScope (const ProfilerSite & site) noexcept :
+    node_ (max_nodes)
+  {
+    ThreadData * data (nullptr);
+    try
+    {
+      data = threadData ();
+    }
+    catch (...)
+    {
+      return;
+    }
+
+    if (data == nullptr)
+    {
+      return;
+    }
+
+    Node * const nodes (data->nodes.get ());
+    const std::size_t parent (data->current_node);
+    std::size_t child (nodes [parent].first_child);
+    while ((child != max_nodes) && (nodes [child].site != & site))
+    {
+      child = nodes [child].next_sibling;
+    }
+
+    if (child == max_nodes)
+    {
+      child = data->nodes_count.load (std::memory_order_relaxed);
+      if (child == max_nodes)
+      {
+        return;
+      }
+
+      nodes [child].site = & site;
+      nodes [child].parent = parent;
+      nodes [child].next_sibling = nodes [parent].first_child;
+      nodes [parent].first_child = child;
+      data->nodes_count.store (child + 1, std::memory_order_release);
+    }
+
+    data->current_node = child;
+    node_ = child;
+    time_started_ = clock_type::now ();
+  }
+
+
+  ProfilerScope::~ ProfilerScope ()
+  {
+    const clock_type::time_point time_stopped (clock_type::now ());
+
+    if (node_ == max_nodes)
+    {
+      return;
+    }
+
+    const std::uint64_t time_elapsed (
+      std::uint64_t (std::chrono::duration_cast <std::chrono::nanoseconds> (time_stopped - time_started_).count ())
+    );
+
+    ThreadData * const data (thread_data);
+    Node & node (data->nodes [node_]);
+    add (node.count, 1);
+    add (node.total, time_elapsed);
+    if (time_elapsed < node.minimum.load (std::memory_order_relaxed))
+    {
+      node.minimum.store (time_elapsed, std::memory_order_relaxed);
+    }
+
+    if (node.maximum.load (std::memory_order_relaxed) < time_elapsed)
+    {
+      node.maximum.store (time_elapsed, std::memory_order_relaxed);
+    }
+
+    add (node.histogram [bucketOf (time_elapsed)], 1);
+
+    const std::size_t events_count (data->events_count.load (std::memory_order_relaxed));
+    std::unique_ptr <Event []> * chunk (nullptr);
+    if (events_count < Config::Utils::Profiler::Trace_capacity)
+    {
+      chunk = & data->event_chunks [events_count / trace_chunk_size];
+      if (* chunk == nullptr)
+      {
+        chunk->reset (new (std::nothrow) Event [trace_chunk_size]);
+      }
+    }
+
+    if ((chunk != nullptr) && (* chunk != nullptr))
+    {
+      (* chunk) [events_count % trace_chunk_size] = Event {
+        node_,
+        std::int64_t (
+          std::chrono::duration_cast <std::chrono::nanoseconds> (time_started_.time_since_epoch ()).count ()
+        ),
+        time_elapsed
+      };
+      data->events_count.store (events_count + 1, std::memory_order_release);
+    }
+    else
+    {
+      add (data->events_dropped, 1);
+    }
+
+    data->current_node = node.parent;
+  }
+
+
+  void
+  Profiler::writeSummary (std::ostream & output)
+  {
+    const std::lock_guard <std::mutex> registry_lock (registry_mutex);
+
+    std::vector <const ThreadData *> threads;
+    for (const std::unique_ptr <ThreadData> & data : registry)
+    {
+      threads.push_back (data.get ());
+    }
+
+    if (exited_data != nullptr)
+    {
+      threads.push_back (exited_data.get ());
+    }
+
+    std::vector <SiteTotals> sites;
+    std::uint64_t events_dropped (retired_events_dropped);
+    for (const ThreadData * const data : threads)
+    {
+      events_dropped += data->events_dropped.load (std::memory_order_relaxed);
+      const std::size_t nodes_count (data->nodes_count.load (std::memory_order_acquire));
+      for (std::size_t index (1); index < nodes_count; ++ index)
+      {
+        const Node & node (data->nodes [index]);
+
+        auto site (
+          std::find_if (
+            sites.begin (), sites.end (),
+            [& node] (const SiteTotals & totals)
+            {
+              return totals.site == node.site;
+            }
+          )
+        );
+        if (site == sites.end ())
+        {
+          site = sites.emplace (sites.end ());
+          site->site = node.site;
+        }
+
+        site->count += node.count.load (std::memory_order_relaxed);
+        site->total += node.total.load (std::memory_order_relaxed);
+        site->minimum = std::min (site->minimum, node.minimum.load (std::memory_order_relaxed));
+        site->maximum = std::max (site->maximum, node.maximum.load (std::memory_order_relaxed));
+        for (std::size_t bucket (0); bucket < buckets; ++ bucket)
+        {
+          site->histogram [bucket] += node.histogram [bucket].load (std::memory_order_relaxed);
+        }
+      }
+    }
+
+    std::sort (
+      sites.begin (), sites.end (),
+      [] (const SiteTotals & x, const SiteTotals & y)
+      {
+        return y.total < x.total;
+      }
+    );
+
+    fmt::print (
+      output, "{0:>12s} {1:>16s} {2:>12s} {3:>12s} {4:>12s} {5:>12s} {6:>12s}  {7:s}\n",
+      "calls", "total, ns", "mean, ns", "min, ns", "max, ns", "p50, ns", "p99, ns", "site"
+    );
+    for (const SiteTotals & site : sites)
+    {
+      if (site.count == 0)
+      {
+        continue;
+      }
+
+      fmt::print (
+        output, "{0:>12d} {1:>16d} {2:>12d} {3:>12d} {4:>12d} {5:>12d} {6:>12d}  {7:s}  ({8:s}:{9:d})\n",
+        site.count, site.total, site.total / site.count, site.minimum, site.maximum,
+        site.percentile (0.5), site.percentile (0.99),
+        nameOf (* site.site), site.site->sourceLocation ().file ().data (), site.site->sourceLocation ().line ()
+      );
+    }
+
+    for (const std::unique_ptr <ThreadData> & data : registry)
+    {
+      fmt::print (output, "\nThread #{0:d}:\n{1:>12s} {2:>16s}  {3:s}\n", data->index, "calls", "total, ns", "scope");
+      writeTree (output, * data, 0, data->nodes_count.load (std::memory_order_acquire), 0);
+    }
+
+    if (exited_data != nullptr)
+    {
+      fmt::print (output, "\nExited threads:\n{0:>12s} {1:>16s}  {2:s}\n", "calls", "total, ns", "scope");
+      writeTree (output, * exited_data, 0, exited_data->nodes_count.load (std::memory_order_acquire), 0);
+    }
+
+    if (events_dropped > 0)
+    {
+      fmt::print (output, "\nTrace:  {0:d}  events dropped beyond  `Trace_capacity'\n", events_dropped);
+    }
+  }
+
+
+  void
+  Profiler::writeTrace (std::ostream & output)
+  {
+    const std::lock_guard <std::mutex> registry_lock (registry_mutex);
+
+    output << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    bool is_first (true);
+    const auto write_event (
+      [& output, & is_first] (
+        const ProfilerSite & site, std::size_t thread_index, std::int64_t time_started, std::uint64_t time_elapsed
+      )
+      {
+        output << ((is_first) ? "\n" : ",\n") << "{\"name\":";
+        writeJsonString (output, nameOf (site));
+        output << ",\"cat\":";
+        writeJsonString (output, site.sourceLocation ().file ().data ());
+        fmt::print (
+          output, ",\"ph\":\"X\",\"pid\":1,\"tid\":{0:d},\"ts\":{1:.3f},\"dur\":{2:.3f}}}",
+          thread_index, double (time_started) / 1e3, double (time_elapsed) / 1e3
+        );
+        is_first = false;
+      }
+    );
+
+    for (const RetiredEvent & event : retired_events)
+    {
+      write_event (* event.site, event.thread_index, event.time_started, event.time_elapsed);
+    }
+
+    std::uint64_t events_dropped (retired_events_dropped);
+    for (const std::unique_ptr <ThreadData> & data : registry)
+    {
+      events_dropped += data->events_dropped.load (std::memory_order_relaxed);
+      const std::size_t events_count (data->events_count.load (std::memory_order_acquire));
+      for (std::size_t index (0); index < events_count; ++ index)
+      {
+        const Event & event (data->event (index));
+        write_event (* data->nodes [event.node].site, data->index, event.time_started, event.time_elapsed);
+      }
+    }
+
+    fmt::print (output, "\n],\"otherData\":{{\"dropped_events\":\"{0:d}\"}}}}\n", events_dropped);
+  }
+
+
+  void
+  Profiler::dumpAtExit (const CString & trace_path)
+  {
+    const bool is_registered (exit_trace_path != nullptr);
+    exit_trace_path = trace_path.data ();
+
+    if (! is_registered)
+    {
+      std::atexit (writeReportsAtExit);
+    }
+  }
+}
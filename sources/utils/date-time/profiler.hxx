@@ -0,0 +1,274 @@
+#ifndef UTILS_DATETIME_PROFILER_HXX
+#define UTILS_DATETIME_PROFILER_HXX
+
+
+#include <cstddef>  // std::size_t
+
+#include <ostream>  // std::ostream
+
+#include "../config/timer.hxx"  // Config::Utils::Timer::{Clock, Default_description}
+#include "../containers/c-string.hxx"  // CString
+#include "../debug/source-location.hxx"  // SourceLocation
+
+
+namespace Utils
+{
+  /**
+   * @brief Static description of a profiled call site.
+   * Meant to be a function-local static,  so it's constant-initialized  &  costs nothing at run time.
+   */
+  class ProfilerSite final
+  {
+    private:
+      /**
+       * @brief
+       */
+      using self_type = ProfilerSite;
+
+
+    public:
+      /**
+       * @brief
+       */
+      constexpr ProfilerSite () noexcept = delete;
+
+      /**
+       * @brief
+       * @param that
+       */
+      constexpr ProfilerSite (const self_type & that [[maybe_unused]]) noexcept = delete;
+
+      /**
+       * @brief
+       * @param that
+       */
+      constexpr ProfilerSite (self_type && that [[maybe_unused]]) noexcept = delete;
+
+
+      /**
+       * @brief
+       * @param source_location
+       */
+      constexpr explicit ProfilerSite (const SourceLocation & source_location) noexcept :
+        source_location_ (source_location)
+      { }
+
+
+      /**
+       * @brief
+       * @param source_location
+       * @param description
+       */
+      constexpr explicit ProfilerSite (const SourceLocation & source_location, const CString & description) noexcept :
+        source_location_ (source_location),
+        description_ (description)
+      { }
+
+
+      /**
+       * @brief
+       * @return
+       */
+      [[nodiscard]] constexpr const SourceLocation &
+      sourceLocation () const noexcept
+      {
+        return source_location_;
+      }
+
+
+      /**
+       * @brief
+       * @return
+       */
+      [[nodiscard]] constexpr const CString &
+      description () const noexcept
+      {
+        return description_;
+      }
+
+
+      /**
+       * @brief
+       * @param that
+       * @return
+       */
+      constexpr self_type &
+      operator = (const self_type & that [[maybe_unused]]) noexcept = delete;
+
+      /**
+       * @brief
+       * @param that
+       * @return
+       */
+      constexpr self_type &
+      operator = (self_type && that [[maybe_unused]]) noexcept = delete;
+
+
+    private:
+      /**
+       * @brief
+       */
+      const SourceLocation source_location_;
+
+      /**
+       * @brief
+       */
+      const CString description_ { Config::Utils::Timer::Default_description };
+  };
+
+
+  /**
+   * @brief Measures one execution of a profiled scope  &  accounts it to the calling thread's call tree.
+   * The call tree node is keyed by the site  &  the enclosing scope;  all the statistics live in thread-local
+   *   storage,  so no locks are taken.
+   */
+  class ProfilerScope final
+  {
+    public:
+      /**
+       * @brief
+       */
+      using clock_type = Config::Utils::Timer::Clock;
+
+
+    private:
+      /**
+       * @brief
+       */
+      using self_type = ProfilerScope;
+
+
+    public:
+      /**
+       * @brief
+       */
+      ProfilerScope () noexcept = delete;
+
+      /**
+       * @brief
+       * @param that
+       */
+      ProfilerScope (const self_type & that [[maybe_unused]]) noexcept = delete;
+
+      /**
+       * @brief
+       * @param that
+       */
+      ProfilerScope (self_type && that [[maybe_unused]]) noexcept = delete;
+
+
+      /**
+       * @brief
+       * @param site
+       */
+      explicit ProfilerScope (const ProfilerSite & site) noexcept;
+
+      /**
+       * @brief
+       */
+      ~ ProfilerScope ();
+
+
+      /**
+       * @brief
+       * @param that
+       * @return
+       */
+      self_type &
+      operator = (const self_type & that [[maybe_unused]]) noexcept = delete;
+
+      /**
+       * @brief
+       * @param that
+       * @return
+       */
+      self_type &
+      operator = (self_type && that [[maybe_unused]]) noexcept = delete;
+
+
+    private:
+      /**
+       * @brief Index of the call tree node,  or  `Max_nodes'  if the tree is full  &  the scope isn't recorded.
+       */
+      std::size_t node_;
+
+      /**
+       * @brief
+       */
+      clock_type::time_point time_started_;
+  };
+
+
+  /**
+   * @brief Reports the statistics collected by  `ProfilerScope's of all threads.
+   */
+  class Profiler final
+  {
+    private:
+      /**
+       * @brief
+       */
+      using self_type = Profiler;
+
+
+    public:
+      /**
+       * @brief
+       */
+      Profiler () noexcept = delete;
+
+      /**
+       * @brief
+       * @param that
+       */
+      Profiler (const self_type & that [[maybe_unused]]) noexcept = delete;
+
+      /**
+       * @brief
+       * @param that
+       */
+      Profiler (self_type && that [[maybe_unused]]) noexcept = delete;
+
+
+      /**
+       * @brief Writes per-site totals  (calls,  total,  mean,  min,  max,  p50,  p99)  &  per-thread call trees.
+       * @param output
+       */
+      static void
+      writeSummary (std::ostream & output);
+
+      /**
+       * @brief Writes recorded scopes as Chrome trace event JSON  (`chrome://tracing',  Perfetto).
+       * @param output
+       */
+      static void
+      writeTrace (std::ostream & output);
+
+      /**
+       * @brief Writes the summary to  `std::clog'  &  the trace to  `trace_path'  at exit.
+       * @param trace_path
+       */
+      static void
+      dumpAtExit (const CString & trace_path);
+
+
+      /**
+       * @brief
+       * @param that
+       * @return
+       */
+      self_type &
+      operator = (const self_type & that [[maybe_unused]]) noexcept = delete;
+
+      /**
+       * @brief
+       * @param that
+       * @return
+       */
+      self_type &
+      operator = (self_type && that [[maybe_unused]]) noexcept = delete;
+  };
+}
+
+
+#endif  // UTILS_DATETIME_PROFILER_HXX
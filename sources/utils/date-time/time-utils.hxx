@@ -5,6 +5,7 @@
 #include <ctime>  // std::tm
 
 #include <chrono>  // std::chrono::nanoseconds::rep
+#include <tuple>  // std::tuple
 
 
 namespace Utils
@@ -47,6 +48,29 @@ namespace Utils
 
     return seconds;
   }
+
+
+  /**
+   * @brief Converts a count of days since 1970-01-01 to a proleptic Gregorian civil date.
+   * See  H. Hinnant,  "chrono-Compatible Low-Level Date Algorithms".
+   * @param days
+   * @return Year,  month  [1; 12]  &  day of month  [1; 31].
+   */
+  [[nodiscard]] constexpr std::tuple <long, int, int>
+  civilFromDays (long days) noexcept
+  {
+    days += 719'468;
+    const long era (((days >= 0) ? days : (days - 146'096)) / 146'097);
+    const long day_of_era (days - era * 146'097);  // [0; 146'096]
+    const long year_of_era ((day_of_era - day_of_era / 1'460 + day_of_era / 36'524 - day_of_era / 146'096) / 365);  // [0; 399]
+    const long day_of_year (day_of_era - (365 * year_of_era + year_of_era / 4 - year_of_era / 100));  // [0; 365]
+    const long month_from_march ((5 * day_of_year + 2) / 153);  // [0; 11]
+    const int day (int (day_of_year - (153 * month_from_march + 2) / 5 + 1));
+    const int month (int ((month_from_march < 10) ? (month_from_march + 3) : (month_from_march - 9)));
+    const long year (year_of_era + era * 400 + (month <= 2));
+
+    return { year, month, day };
+  }
 }
 
 
@@ -2,12 +2,14 @@
 #define UTILS_DATETIME_TIMER_HXX
 
 
-#include <chrono>  // std::chrono::steady_clock
-
-#include "../config/timer.hxx"  // Config::Utils::Timer::Default_description
+#include "../config/timer.hxx"  // Config::Utils::Timer::{Clock, Default_description}
 #include "../containers/c-string.hxx"  // CString
 #include "../misc/bool-flag.hxx"  // BoolFlag
 #include "../preproc/paste.hxx"  // PASTE_E
+#ifdef WITH_PROFILER
+#include "../debug/source-location.hxx"  // CURRENT_SOURCE_LOCATION
+#include "profiler.hxx"  // ProfilerScope,  ProfilerSite
+#endif  // WITH_PROFILER
 
 
 namespace Utils
@@ -15,7 +17,7 @@ namespace Utils
   /**
    * @brief Measures execution time using high resolution clock.
    * Logs elapsed time on destruction  (in automatic mode only).
-   * TODO:  [0;1]  `clock_type'  as a template parameter.
+   * The clock is selected at compile time,  see  `Config::Utils::Timer::Clock'.
    * TODO:  [1;1]  Split to two classes:  manual  &  automatic.
    * TODO:  [1;2]  Add file  &  line to the description.
    */
@@ -25,7 +27,7 @@ namespace Utils
       /**
        * @brief
        */
-      using clock_type = std::chrono::steady_clock;
+      using clock_type = Config::Utils::Timer::Clock;
 
 
     private:
@@ -204,10 +206,24 @@ namespace Utils
 
 
 #ifdef WITH_TIMERS
+#ifdef WITH_PROFILER
+/**
+ * @brief Accounts the enclosing scope to the profiler instead of logging it  (see  `ProfilerScope').
+ */
+#define TIMER_AUTO() TIMER_AUTO_N_ (__COUNTER__)
+
+/**
+ * @brief  `TIMER_AUTO'  with its names suffixed by  `n',  so both of them use the same  `__COUNTER__'  value.
+ */
+#define TIMER_AUTO_N_(n) \
+  static const ::Utils::ProfilerSite (PASTE_E (profiler_site_, n)) ((CURRENT_SOURCE_LOCATION ()), (__PRETTY_FUNCTION__)); \
+  const ::Utils::ProfilerScope (PASTE_E (profiler_scope_, n)) ((PASTE_E (profiler_site_, n)))
+#else  // WITH_PROFILER
 /**
  * @brief
  */
 #define TIMER_AUTO() const ::Utils::Timer (PASTE_E (timer_, __COUNTER__)) (__PRETTY_FUNCTION__)
+#endif  // WITH_PROFILER
 
 
 /**
@@ -240,6 +256,19 @@ namespace Utils
   while (false)
 
 
+#ifdef WITH_PROFILER
+/**
+ * @brief Accounts the wrapped code to the profiler instead of logging it  (see  `ProfilerScope').
+ */
+#define TIMER_WRAP(id, description, ...) \
+  do \
+  { \
+    static const ::Utils::ProfilerSite (PASTE_E (profiler_site_, id)) ((CURRENT_SOURCE_LOCATION ()), (description)); \
+    const ::Utils::ProfilerScope (PASTE_E (profiler_scope_, id)) ((PASTE_E (profiler_site_, id))); \
+    __VA_ARGS__ \
+  } \
+  while (false)
+#else  // WITH_PROFILER
 #define TIMER_WRAP(id, description, ...) \
   do \
   { \
@@ -249,6 +278,7 @@ namespace Utils
     TIMER_STOP (id); \
   } \
   while (false)
+#endif  // WITH_PROFILER
 #else  // WITH_TIMERS
 #define TIMER_AUTO() (void (0))
 
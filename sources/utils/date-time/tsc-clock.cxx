@@ -0,0 +1,53 @@
+#include "tsc-clock.hxx"  // TscClock::*
+
+#include <cstdint>  // std::uint64_t
+
+#include <chrono>  // std::chrono::{duration, steady_clock}
+#include <ratio>  // std::nano
+
+#include "../config/tsc-clock.hxx"  // Config::Utils::TscClock::Calibration_interval
+
+
+namespace Utils
+{
+  namespace
+  {
+    /**
+     * @brief Busy-waits for  `Calibration_interval'  &  compares the elapsed ticks with the elapsed steady time.
+     * @return
+     */
+    double
+    calibrate () noexcept
+    {
+#if defined (__x86_64__) || defined (__i386__)
+      using clock_type = std::chrono::steady_clock;
+
+
+      const clock_type::time_point time_started (clock_type::now ());
+      const std::uint64_t ticks_started (TscClock::ticks ());
+
+      clock_type::time_point time_stopped (clock_type::now ());
+      while (time_stopped - time_started < Config::Utils::TscClock::Calibration_interval)
+      {
+        time_stopped = clock_type::now ();
+      }
+
+      const std::uint64_t ticks_stopped (TscClock::ticks ());
+      const std::chrono::duration <double, std::nano> time_elapsed (time_stopped - time_started);
+
+      return time_elapsed.count () / double (ticks_stopped - ticks_started);
+#else  // defined (__x86_64__) || defined (__i386__)
+      return 1.0;
+#endif  // defined (__x86_64__) || defined (__i386__)
+    }
+  }
+
+
+  double
+  TscClock::nanosecondsPerTick () noexcept
+  {
+    static const double nanoseconds_per_tick (calibrate ());
+
+    return nanoseconds_per_tick;
+  }
+}
@@ -0,0 +1,138 @@
+#ifndef UTILS_DATETIME_TSCCLOCK_HXX
+#define UTILS_DATETIME_TSCCLOCK_HXX
+
+
+#include <cstdint>  // std::{int64_t, uint64_t}
+
+#include <chrono>  // std::chrono::{nanoseconds, steady_clock, time_point}
+#include <ratio>  // std::nano
+
+#if defined (__x86_64__) || defined (__i386__)
+#include <x86intrin.h>  // __rdtsc
+#endif  // defined (__x86_64__) || defined (__i386__)
+
+
+namespace Utils
+{
+  /**
+   * @brief Clock based on the time stamp counter,  satisfies the  `TrivialClock'  requirements.
+   * The counter frequency is calibrated against  `std::chrono::steady_clock'  on the first use.
+   * Assumes an invariant TSC  (constant rate,  synchronized between cores);  falls back to
+   *   `std::chrono::steady_clock'  on other architectures.
+   */
+  class TscClock final
+  {
+    public:
+      /**
+       * @brief
+       */
+      using rep = std::int64_t;
+
+      /**
+       * @brief
+       */
+      using period = std::nano;
+
+      /**
+       * @brief
+       */
+      using duration = std::chrono::nanoseconds;
+
+      /**
+       * @brief
+       */
+      using time_point = std::chrono::time_point <TscClock>;
+
+
+      /**
+       * @brief
+       */
+      static constexpr bool is_steady { true };
+
+
+    private:
+      /**
+       * @brief
+       */
+      using self_type = TscClock;
+
+
+    public:
+      /**
+       * @brief
+       */
+      TscClock () noexcept = delete;
+
+      /**
+       * @brief
+       * @param that
+       */
+      TscClock (const self_type & that [[maybe_unused]]) noexcept = delete;
+
+      /**
+       * @brief
+       * @param that
+       */
+      TscClock (self_type && that [[maybe_unused]]) noexcept = delete;
+
+
+      /**
+       * @brief
+       * @return
+       */
+      [[nodiscard]] static time_point
+      now () noexcept
+      {
+        // Calibrate first,  so calibration time isn't included into the very first reading:
+        const double nanoseconds_per_tick (nanosecondsPerTick ());
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wconversion"
+        return time_point (duration (rep (double (ticks ()) * nanoseconds_per_tick)));
+#pragma GCC diagnostic pop
+      }
+
+
+      /**
+       * @brief Raw counter value.
+       * @return
+       */
+      [[nodiscard]] static std::uint64_t
+      ticks () noexcept
+      {
+#if defined (__x86_64__) || defined (__i386__)
+        return __rdtsc ();
+#else  // defined (__x86_64__) || defined (__i386__)
+        return std::uint64_t (std::chrono::steady_clock::now ().time_since_epoch ().count ());
+#endif  // defined (__x86_64__) || defined (__i386__)
+      }
+
+
+      /**
+       * @brief
+       * @return
+       */
+      [[nodiscard]] static double
+      nanosecondsPerTick () noexcept;
+
+
+      /**
+       * @brief
+       * @param that
+       * @return
+       */
+      self_type &
+      operator = (const self_type & that [[maybe_unused]]) noexcept = delete;
+
+      /**
+       * @brief
+       * @param that
+       * @return
+       */
+      self_type &
+      operator = (self_type && that [[maybe_unused]]) noexcept = delete;
+  };
+}
+
+
+#endif  // UTILS_DATETIME_TSCCLOCK_HXX
@@ -4,7 +4,7 @@
 
 #include "../config/logger.hxx"  // Config::Utils::Logger::Fatal_prefix
 #include "../containers/c-string.hxx"  // CString
-#include "../logging/logger.hxx"  // Logger::{log, log_Detailed}
+#include "../logging/logger.hxx"  // Logger::{log, log_Detailed, tryFlush}
 #include "source-location.hxx"  // SourceLocation
 
 
@@ -13,6 +13,8 @@ namespace Utils
   [[noreturn]] void
   crashProgram () noexcept
   {
+    Logger::tryFlush ();
+
     std::abort ();
   }
 
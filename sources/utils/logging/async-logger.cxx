@@ -0,0 +1,498 @@
+#include "async-logger.hxx"  // AsyncLogger::*
+
+#include <cerrno>  // EINTR, errno
+#include <cstddef>  // std::size_t
+
+#include <algorithm>  // std::any_of
+#include <atomic>  // std::{atomic, memory_order_*}
+#include <chrono>  // std::chrono::steady_clock
+#include <exception>  // std::exception
+#include <memory>  // std::{make_unique, unique_ptr}
+#include <mutex>  // std::{adopt_lock, lock_guard, mutex}
+#include <string>  // std::string
+#include <thread>  // std::{this_thread::*, thread}
+#include <utility>  // std::move
+#include <vector>  // std::vector
+
+#include <unistd.h>  // ::write
+
+#include <fmt/format.h>  // fmt::format
+
+#include "../config/async-logger.hxx"  // Config::Utils::AsyncLogger::{Batch_size, Crash_flush_timeout, Poll_interval}
+
+
+namespace Utils
+{
+  namespace
+  {
+    /**
+     * @brief
+     */
+    std::mutex registry_mutex;
+
+    /**
+     * @brief Rings of the threads that may still log,  or whose entries haven't been drained yet.
+     */
+    std::vector <std::unique_ptr <AsyncLoggerInternals_::Ring_>> rings;
+
+    /**
+     * @brief Drained rings of exited threads,  waiting for new threads.
+     */
+    std::vector <std::unique_ptr <AsyncLoggerInternals_::Ring_>> free_rings;
+
+    /**
+     * @brief Whether the calling thread has retired its ring.
+     */
+    thread_local bool is_ring_retired { };
+
+    /**
+     * @brief Serializes consumers:  the background thread  &  explicit  `flush'  calls.
+     */
+    std::mutex drain_mutex;
+
+    /**
+     * @brief
+     */
+    std::thread consumer;
+
+    /**
+     * @brief
+     */
+    std::atomic <bool> is_stop_requested { };
+
+    /**
+     * @brief
+     */
+    std::atomic <int> output_file_descriptor { 2 };
+
+    /**
+     * @brief
+     */
+    std::atomic <AsyncLogOverflowPolicy> current_overflow_policy { AsyncLogOverflowPolicy::Block };
+
+
+    /**
+     * @brief
+     * @param data
+     * @param size
+     */
+    void
+    writeOut (const char * data, std::size_t size) noexcept
+    {
+      const int file_descriptor (output_file_descriptor.load (std::memory_order_relaxed));
+      while (size > 0)
+      {
+        const ::ssize_t written (::write (file_descriptor, data, size));
+        if (written < 0)
+        {
+          if (errno == EINTR)
+          {
+            continue;
+          }
+
+          return;
+        }
+
+        data += written;
+        size -= std::size_t (written);
+      }
+    }
+
+
+    /**
+     * @brief
+     * @param entry
+     * @param output
+     */
+    void
+    formatEntry (const AsyncLoggerInternals_::Entry_ & entry, std::string & output)
+    {
+      output += fmt::format ("{0:d}/{1:s} ", entry.message_id, entry.prefix);
+      entry.format_function (entry, output);
+      if (entry.is_detailed)
+      {
+        output += fmt::format (
+          "  (in  `{0:s}'  at  `{1:s}:{2:d}')",
+          entry.source_location.function ().data (), entry.source_location.file ().data (),
+          entry.source_location.line ()
+        );
+      }
+
+      output += '\n';
+    }
+
+
+    /**
+     * @brief Replaces whatever has been formatted of  `entry'  past  `size'  in  `output'  with a placeholder.
+     * @param entry
+     * @param reason
+     * @param size
+     * @param output
+     */
+    void
+    formatError (
+      const AsyncLoggerInternals_::Entry_ & entry, const char * reason, std::size_t size, std::string & output
+    ) noexcept
+    {
+      output.resize (size);
+      try
+      {
+        output += fmt::format ("{0:d}/{1:s} <format error:  {2:s}>\n", entry.message_id, entry.prefix, reason);
+      }
+      catch (...)
+      { }
+    }
+
+
+    /**
+     * @brief Formats  `entry'  into  `output',  or a placeholder if formatting throws,  so a bad entry is consumed
+     *   like any other.
+     * @param entry
+     * @param output
+     */
+    void
+    formatEntry_Safe (const AsyncLoggerInternals_::Entry_ & entry, std::string & output) noexcept
+    {
+      const std::size_t size (output.size ());
+      try
+      {
+        formatEntry (entry, output);
+      }
+      catch (const std::exception & exception)
+      {
+        formatError (entry, exception.what (), size, output);
+      }
+      catch (...)
+      {
+        formatError (entry, "unknown exception", size, output);
+      }
+    }
+
+
+    /**
+     * @brief Marks the calling thread as draining for its lifetime,  see  `AsyncLoggerInternals_::is_draining_'.
+     */
+    class DrainingScope final
+    {
+      public:
+        /**
+         * @brief
+         */
+        DrainingScope () noexcept
+        {
+          AsyncLoggerInternals_::is_draining_ = true;
+        }
+
+        /**
+         * @brief
+         * @param that
+         */
+        DrainingScope (const DrainingScope & that [[maybe_unused]]) noexcept = delete;
+
+        /**
+         * @brief
+         * @param that
+         */
+        DrainingScope (DrainingScope && that [[maybe_unused]]) noexcept = delete;
+
+
+        /**
+         * @brief
+         */
+        ~ DrainingScope ()
+        {
+          AsyncLoggerInternals_::is_draining_ = false;
+        }
+
+
+        /**
+         * @brief
+         * @param that
+         * @return
+         */
+        DrainingScope &
+        operator = (const DrainingScope & that [[maybe_unused]]) noexcept = delete;
+
+        /**
+         * @brief
+         * @param that
+         * @return
+         */
+        DrainingScope &
+        operator = (DrainingScope && that [[maybe_unused]]) noexcept = delete;
+    };
+
+
+    /**
+     * @brief Must be called with  `drain_mutex'  held.
+     * Rings of exited threads are moved to  `free_rings'  once drained.
+     * @return Number of written entries.
+     * @throws std::bad_alloc Before any entry is consumed.
+     */
+    std::size_t
+    drain ()
+    {
+      const DrainingScope draining_scope;
+
+      std::string batch;
+      batch.reserve (Config::Utils::AsyncLogger::Batch_size);
+
+      std::size_t count (0);
+      const std::lock_guard <std::mutex> registry_lock (registry_mutex);
+      free_rings.reserve (free_rings.size () + rings.size ());
+      for (std::size_t index (0); index < rings.size (); )
+      {
+        AsyncLoggerInternals_::Ring_ & ring (* rings [index]);
+        const bool is_retired (ring.isRetired ());
+        count += ring.consume (
+          [& batch] (const AsyncLoggerInternals_::Entry_ & entry)
+          {
+            formatEntry_Safe (entry, batch);
+
+            if (! (batch.size () < Config::Utils::AsyncLogger::Batch_size))
+            {
+              writeOut (batch.data (), batch.size ());
+              batch.clear ();
+            }
+          }
+        );
+
+        if (is_retired)
+        {
+          free_rings.push_back (std::move (rings [index]));
+          rings [index] = std::move (rings.back ());
+          rings.pop_back ();
+        }
+        else
+        {
+          ++ index;
+        }
+      }
+
+      writeOut (batch.data (), batch.size ());
+
+      return count;
+    }
+
+
+    /**
+     * @brief
+     */
+    void
+    consume ()
+    {
+      while (! is_stop_requested.load (std::memory_order_acquire))
+      {
+        std::size_t count (0);
+        try
+        {
+          const std::lock_guard <std::mutex> drain_lock (drain_mutex);
+          count = drain ();
+        }
+        catch (...)
+        {
+          // Out of memory:  the entries stay in their rings until the next attempt.
+        }
+
+        if (count == 0)
+        {
+          std::this_thread::sleep_for (Config::Utils::AsyncLogger::Poll_interval);
+        }
+      }
+    }
+  }
+
+
+  void
+  AsyncLogger::start (int file_descriptor, AsyncLogOverflowPolicy overflow_policy)
+  {
+    if (isRunning ())
+    {
+      return;
+    }
+
+    output_file_descriptor.store (file_descriptor, std::memory_order_relaxed);
+    current_overflow_policy.store (overflow_policy, std::memory_order_relaxed);
+    is_stop_requested.store (false, std::memory_order_relaxed);
+    consumer = std::thread (consume);
+    is_running_.store (true, std::memory_order_release);
+  }
+
+
+  void
+  AsyncLogger::stop ()
+  {
+    if (! isRunning ())
+    {
+      return;
+    }
+
+    is_running_.store (false, std::memory_order_seq_cst);
+
+    // Producers that saw the logger running are still writing their entries,  see  `Ring_::beginWrite'.
+    while (true)
+    {
+      {
+        const std::lock_guard <std::mutex> registry_lock (registry_mutex);
+        const bool is_writing (
+          std::any_of (
+            rings.cbegin (), rings.cend (),
+            [] (const std::unique_ptr <ring_type> & ring)
+            {
+              return ring->isWriting ();
+            }
+          )
+        );
+        if (! is_writing)
+        {
+          break;
+        }
+      }
+
+      std::this_thread::yield ();
+    }
+
+    is_stop_requested.store (true, std::memory_order_release);
+    consumer.join ();
+
+    flush ();
+  }
+
+
+  void
+  AsyncLogger::flush () noexcept
+  {
+    if (AsyncLoggerInternals_::is_draining_)
+    {
+      return;
+    }
+
+    try
+    {
+      const std::lock_guard <std::mutex> drain_lock (drain_mutex);
+      drain ();
+    }
+    catch (...)
+    { }
+  }
+
+
+  bool
+  AsyncLogger::tryFlush () noexcept
+  {
+    if (AsyncLoggerInternals_::is_draining_)
+    {
+      return false;
+    }
+
+    const std::chrono::steady_clock::time_point deadline (
+      std::chrono::steady_clock::now () + Config::Utils::AsyncLogger::Crash_flush_timeout
+    );
+    while (! drain_mutex.try_lock ())
+    {
+      if (! (std::chrono::steady_clock::now () < deadline))
+      {
+        return false;
+      }
+
+      std::this_thread::yield ();
+    }
+
+    try
+    {
+      const std::lock_guard <std::mutex> drain_lock (drain_mutex, std::adopt_lock);
+      drain ();
+    }
+    catch (...)
+    {
+      return false;
+    }
+
+    return true;
+  }
+
+
+  void
+  AsyncLogger::formatText_ (const entry_type & entry, std::string & output)
+  {
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wold-style-cast"
+    output.append ((const char *) entry.arguments, entry.text_size);
+#pragma GCC diagnostic pop
+  }
+
+
+  /**
+   * @brief
+   */
+  struct AsyncLogger::RingOwner_ final
+  {
+    /**
+     * @brief
+     */
+    ~ RingOwner_ ()
+    {
+      is_ring_retired = true;
+      if (ring_ != nullptr)
+      {
+        ring_->retire ();
+        ring_ = nullptr;
+      }
+    }
+  };
+
+
+  AsyncLogger::ring_type *
+  AsyncLogger::registerRing_ ()
+  {
+    if (is_ring_retired)
+    {
+      return nullptr;
+    }
+
+    // Thread-locals destroyed after it log synchronously,  see  `is_ring_retired'.
+    thread_local RingOwner_ ring_owner;
+
+    const std::lock_guard <std::mutex> registry_lock (registry_mutex);
+    if (free_rings.empty ())
+    {
+      rings.push_back (std::make_unique <ring_type> ());
+    }
+    else
+    {
+      rings.push_back (std::move (free_rings.back ()));
+      free_rings.pop_back ();
+      rings.back ()->reuse ();
+    }
+
+    return rings.back ().get ();
+  }
+
+
+  AsyncLogger::entry_type *
+  AsyncLogger::acquireOnOverflow_ ()
+  {
+    if (current_overflow_policy.load (std::memory_order_relaxed) == AsyncLogOverflowPolicy::Drop)
+    {
+      dropped_count_.fetch_add (1, std::memory_order_relaxed);
+
+      return nullptr;
+    }
+
+    // Keeps waiting while  `stop'  waits for this producer,  the consumer still drains the ring.
+    while (! is_stop_requested.load (std::memory_order_acquire))
+    {
+      entry_type * const entry (ring_->tryAcquire ());
+      if (entry != nullptr)
+      {
+        return entry;
+      }
+
+      std::this_thread::yield ();
+    }
+
+    dropped_count_.fetch_add (1, std::memory_order_relaxed);
+
+    return nullptr;
+  }
+}
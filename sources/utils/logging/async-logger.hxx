@@ -0,0 +1,832 @@
+#ifndef UTILS_LOGGING_ASYNCLOGGER_HXX
+#define UTILS_LOGGING_ASYNCLOGGER_HXX
+
+
+#include <cstddef>  // std::{byte, max_align_t, size_t}
+
+#include <algorithm>  // std::{copy_n, find}
+#include <atomic>  // std::{atomic, memory_order_*}
+#include <memory>  // std::unique_ptr
+#include <new>  // std::launder
+#include <string>  // std::string
+#include <string_view>  // std::string_view
+#include <tuple>  // std::{apply, tuple}
+#include <type_traits>  // std::{conditional_t, is_arithmetic_v, is_enum_v, is_same_v, is_trivially_destructible_v}
+
+#include <fmt/format.h>  // fmt::format
+
+#include "../config/async-logger.hxx"  // Config::Utils::AsyncLogger::{Arguments_capacity, Ring_capacity}
+#include "../containers/c-string.hxx"  // CString
+#include "../debug/source-location.hxx"  // SourceLocation
+
+
+namespace Utils
+{
+  /**
+   * @brief What to do when the calling thread's ring is full.
+   */
+  enum struct AsyncLogOverflowPolicy : unsigned
+  {
+    Block = 0,
+    Drop = 1,
+  };
+
+
+  namespace AsyncLoggerInternals_
+  {
+    /**
+     * @brief Types that can be copied into the ring  &  formatted later on the consumer thread.
+     * `CString'  may refer to any character array,  not only to a literal,  so its characters are copied into the
+     *   entry  (see  `DeferredString_').
+     * @tparam TType
+     */
+    template <typename TType>
+    inline constexpr bool IsDeferrableV_ (
+         std::is_arithmetic_v <TType>
+      || std::is_enum_v <TType>
+      || std::is_same_v <TType, CString>
+    );
+
+
+    /**
+     * @brief  `CString'  argument copied into an entry:  `size'  characters at  `offset'  in its arguments.
+     */
+    struct DeferredString_ final
+    {
+      /**
+       * @brief
+       */
+      std::size_t offset;
+
+      /**
+       * @brief
+       */
+      std::size_t size;
+    };
+
+
+    /**
+     * @brief How an argument of type  `TType'  is stored in an entry.
+     * @tparam TType
+     */
+    template <typename TType>
+    using DeferredT_ = std::conditional_t <std::is_same_v <TType, CString>, DeferredString_, TType>;
+
+
+    /**
+     * @brief
+     * @tparam TArgs
+     */
+    template <typename ... TArgs>
+    using DeferredArgumentsT_ = std::tuple <DeferredT_ <TArgs> ...>;
+
+
+    /**
+     * @brief
+     * @tparam TArgs
+     */
+    template <typename ... TArgs>
+    inline constexpr bool AreDeferrableV_ (
+         (IsDeferrableV_ <TArgs> && ...)
+      && std::is_trivially_destructible_v <DeferredArgumentsT_ <TArgs ...>>
+      && (sizeof (DeferredArgumentsT_ <TArgs ...>) <= Config::Utils::AsyncLogger::Arguments_capacity)
+      && (alignof (DeferredArgumentsT_ <TArgs ...>) <= alignof (std::max_align_t))
+    );
+
+
+    /**
+     * @brief A single ring slot.
+     * Holds either the binary-encoded arguments  (`std::tuple <TArgs ...>')  or the already formatted text,  see
+     *   `format_function'.
+     */
+    struct Entry_ final
+    {
+      /**
+       * @brief
+       */
+      using format_function_type = void (*) (const Entry_ & entry, std::string & output);
+
+
+      /**
+       * @brief
+       */
+      format_function_type format_function { };
+
+      /**
+       * @brief
+       */
+      std::size_t message_id { };
+
+      /**
+       * @brief
+       */
+      const char * prefix { };
+
+      /**
+       * @brief
+       */
+      const char * format { };
+
+      /**
+       * @brief
+       */
+      SourceLocation source_location;
+
+      /**
+       * @brief
+       */
+      bool is_detailed { };
+
+      /**
+       * @brief
+       */
+      std::size_t text_size { };
+
+      /**
+       * @brief  `DeferredArgumentsT_ <TArgs ...>'  followed by the characters of its  `DeferredString_'s,  or text.
+       */
+      alignas (std::max_align_t) std::byte arguments [Config::Utils::AsyncLogger::Arguments_capacity];
+    };
+
+
+    /**
+     * @brief Lock-free single-producer single-consumer ring of entries.
+     * The producer is the owning thread,  the consumer is whoever holds the drain lock of  `AsyncLogger'.
+     */
+    class Ring_ final
+    {
+      private:
+        /**
+         * @brief
+         */
+        using self_type = Ring_;
+
+
+      public:
+        /**
+         * @brief
+         */
+        Ring_ () :
+          entries_ (new Entry_ [capacity_])
+        { }
+
+        /**
+         * @brief
+         * @param that
+         */
+        Ring_ (const self_type & that [[maybe_unused]]) = delete;
+
+        /**
+         * @brief
+         * @param that
+         */
+        Ring_ (self_type && that [[maybe_unused]]) = delete;
+
+
+        /**
+         * @brief Producer side.
+         * @return The next free slot,  or  `nullptr'  if the ring is full.
+         */
+        [[nodiscard]] Entry_ *
+        tryAcquire () noexcept
+        {
+          const std::size_t tail (tail_.load (std::memory_order_relaxed));
+          if (tail - cached_head_ == capacity_)
+          {
+            cached_head_ = head_.load (std::memory_order_acquire);
+            if (tail - cached_head_ == capacity_)
+            {
+              return nullptr;
+            }
+          }
+
+          return & entries_ [tail & (capacity_ - 1)];
+        }
+
+
+        /**
+         * @brief Producer side:  makes the slot returned by  `tryAcquire'  visible to the consumer.
+         */
+        void
+        publish () noexcept
+        {
+          tail_.store (tail_.load (std::memory_order_relaxed) + 1, std::memory_order_release);
+        }
+
+
+        /**
+         * @brief Producer side:  announces an entry being written,  see  `isWriting'.
+         * Sequentially consistent,  so a producer that then sees the logger running is seen by  `AsyncLogger::stop'.
+         */
+        void
+        beginWrite () noexcept
+        {
+          is_writing_.store (true, std::memory_order_seq_cst);
+        }
+
+
+        /**
+         * @brief Producer side.
+         */
+        void
+        endWrite () noexcept
+        {
+          is_writing_.store (false, std::memory_order_release);
+        }
+
+
+        /**
+         * @brief
+         * @return
+         */
+        [[nodiscard]] bool
+        isWriting () const noexcept
+        {
+          return is_writing_.load (std::memory_order_seq_cst);
+        }
+
+
+        /**
+         * @brief Producer side:  the owning thread won't write anymore,  the ring may be reused once drained.
+         */
+        void
+        retire () noexcept
+        {
+          is_retired_.store (true, std::memory_order_release);
+        }
+
+
+        /**
+         * @brief Consumer side:  checked before  `consume',  so a retired ring is empty after it.
+         * @return
+         */
+        [[nodiscard]] bool
+        isRetired () const noexcept
+        {
+          return is_retired_.load (std::memory_order_acquire);
+        }
+
+
+        /**
+         * @brief Hands a drained retired ring over to a new owning thread.
+         */
+        void
+        reuse () noexcept
+        {
+          is_retired_.store (false, std::memory_order_relaxed);
+        }
+
+
+        /**
+         * @brief Consumer side:  calls  `consume (entry)'  for every published entry,  then releases them all at once.
+         * @tparam TConsume
+         * @param consume
+         * @return Number of consumed entries.
+         */
+        template <typename TConsume>
+        std::size_t
+        consume (TConsume && consume)
+        {
+          const std::size_t head (head_.load (std::memory_order_relaxed));
+          const std::size_t tail (tail_.load (std::memory_order_acquire));
+          for (std::size_t index (head); index != tail; ++ index)
+          {
+            consume (entries_ [index & (capacity_ - 1)]);
+          }
+
+          head_.store (tail, std::memory_order_release);
+
+          return tail - head;
+        }
+
+
+        /**
+         * @brief
+         * @param that
+         * @return
+         */
+        self_type &
+        operator = (const self_type & that [[maybe_unused]]) = delete;
+
+        /**
+         * @brief
+         * @param that
+         * @return
+         */
+        self_type &
+        operator = (self_type && that [[maybe_unused]]) = delete;
+
+
+      private:
+        /**
+         * @brief
+         */
+        static constexpr std::size_t capacity_ { Config::Utils::AsyncLogger::Ring_capacity };
+
+        static_assert ((capacity_ & (capacity_ - 1)) == 0, "`Ring_capacity'  must be a power of two");
+
+        /**
+         * @brief
+         */
+        alignas (64) std::atomic <std::size_t> head_ { };
+
+        /**
+         * @brief
+         */
+        alignas (64) std::atomic <std::size_t> tail_ { };
+
+        /**
+         * @brief Producer's copy of  `head_',  so the shared cache line is only touched when the ring looks full.
+         */
+        std::size_t cached_head_ { };
+
+        /**
+         * @brief
+         */
+        std::atomic <bool> is_writing_ { };
+
+        /**
+         * @brief
+         */
+        std::atomic <bool> is_retired_ { };
+
+        /**
+         * @brief
+         */
+        const std::unique_ptr <Entry_ []> entries_;
+    };
+
+
+    /**
+     * @brief Whether the calling thread is draining the rings;  its own messages are then written synchronously.
+     */
+    inline thread_local bool is_draining_ { };
+  }
+
+
+  /**
+   * @brief Asynchronous backend for  `Logger'.
+   * Callers copy the format string pointer  &  binary-encoded arguments into a per-thread ring;  a background
+   *   consumer thread formats the entries  &  writes them in batches to a file descriptor.
+   * Arguments that can't be deferred  (see  `IsDeferrableV_'),  or whose strings don't fit  `Arguments_capacity',
+   *   are formatted on the calling thread  &  stored as text,  truncated to  `Arguments_capacity'.
+   * Entries of different threads are written ring by ring;  use message ids to restore the global order.
+   * The ring of a thread is reused by other threads once the thread exits  &  the ring is drained.
+   */
+  class AsyncLogger final
+  {
+    private:
+      /**
+       * @brief
+       */
+      using self_type = AsyncLogger;
+
+      /**
+       * @brief
+       */
+      using entry_type = AsyncLoggerInternals_::Entry_;
+
+      /**
+       * @brief
+       */
+      using ring_type = AsyncLoggerInternals_::Ring_;
+
+
+    public:
+      /**
+       * @brief
+       */
+      AsyncLogger () noexcept = delete;
+
+      /**
+       * @brief
+       * @param that
+       */
+      AsyncLogger (const self_type & that [[maybe_unused]]) noexcept = delete;
+
+      /**
+       * @brief
+       * @param that
+       */
+      AsyncLogger (self_type && that [[maybe_unused]]) noexcept = delete;
+
+
+      /**
+       * @brief Starts the consumer thread.
+       * @param file_descriptor
+       * @param overflow_policy
+       */
+      static void
+      start (int file_descriptor, AsyncLogOverflowPolicy overflow_policy = AsyncLogOverflowPolicy::Block);
+
+      /**
+       * @brief Waits for the messages being queued,  stops the consumer thread  &  writes out everything that's been
+       *   queued.
+       */
+      static void
+      stop ();
+
+      /**
+       * @brief Formats  &  writes out everything that's been queued so far on the calling thread.
+       */
+      static void
+      flush () noexcept;
+
+      /**
+       * @brief Same as  `flush',  but for the crash path:  gives up instead of waiting for another drain for longer
+       *   than  `Crash_flush_timeout',  or re-entering a drain of the calling thread.
+       * @return Whether everything's been written out.
+       */
+      static bool
+      tryFlush () noexcept;
+
+      /**
+       * @brief
+       * @return
+       */
+      [[nodiscard]] static bool
+      isRunning () noexcept
+      {
+        return is_running_.load (std::memory_order_acquire);
+      }
+
+      /**
+       * @brief
+       * @return Number of entries dropped because of  `AsyncLogOverflowPolicy::Drop'.
+       */
+      [[nodiscard]] static std::size_t
+      droppedCount () noexcept
+      {
+        return dropped_count_.load (std::memory_order_relaxed);
+      }
+
+
+      /**
+       * @brief
+       * @tparam TArgs
+       * @param message_id
+       * @param prefix
+       * @param format
+       * @param args
+       * @return  `false'  if the logger isn't running  &  the message must be written synchronously.
+       */
+      template <typename ... TArgs>
+      static bool
+      log (std::size_t message_id, const CString & prefix, const CString & format, const TArgs & ... args)
+      {
+        return enqueue_ (message_id, nullptr, prefix, format, args ...);
+      }
+
+
+      /**
+       * @brief
+       * @tparam TArgs
+       * @param message_id
+       * @param source_location
+       * @param prefix
+       * @param format
+       * @param args
+       * @return  `false'  if the logger isn't running  &  the message must be written synchronously.
+       */
+      template <typename ... TArgs>
+      static bool
+      log_Detailed (
+        std::size_t message_id, const SourceLocation & source_location,
+        const CString & prefix, const CString & format, const TArgs & ... args
+      )
+      {
+        return enqueue_ (message_id, & source_location, prefix, format, args ...);
+      }
+
+
+      /**
+       * @brief
+       * @param that
+       * @return
+       */
+      self_type &
+      operator = (const self_type & that [[maybe_unused]]) noexcept = delete;
+
+      /**
+       * @brief
+       * @param that
+       * @return
+       */
+      self_type &
+      operator = (self_type && that [[maybe_unused]]) noexcept = delete;
+
+
+    private:
+      /**
+       * @brief
+       * @tparam TArgs
+       * @param message_id
+       * @param source_location
+       * @param prefix
+       * @param format
+       * @param args
+       * @return
+       */
+      template <typename ... TArgs>
+      static bool
+      enqueue_ (
+        std::size_t message_id, const SourceLocation * source_location,
+        const CString & prefix, const CString & format, const TArgs & ... args
+      )
+      {
+        if ((! isRunning ()) || AsyncLoggerInternals_::is_draining_)
+        {
+          return false;
+        }
+
+        if (ring_ == nullptr)
+        {
+          ring_ = registerRing_ ();
+          if (ring_ == nullptr)
+          {
+            return false;
+          }
+        }
+
+        ring_->beginWrite ();
+        if (! isRunning ())
+        {
+          ring_->endWrite ();
+
+          return false;
+        }
+
+        entry_type * entry (ring_->tryAcquire ());
+        if (entry == nullptr)
+        {
+          entry = acquireOnOverflow_ ();
+          if (entry == nullptr)
+          {
+            ring_->endWrite ();
+
+            return true;
+          }
+        }
+
+        entry->message_id = message_id;
+        entry->prefix = prefix.data ();
+        entry->format = format.data ();
+        entry->is_detailed = (source_location != nullptr);
+        if (source_location != nullptr)
+        {
+          entry->source_location = * source_location;
+        }
+
+        try
+        {
+          store_ (* entry, format, args ...);
+        }
+        catch (...)
+        {
+          ring_->endWrite ();
+
+          throw;
+        }
+
+        ring_->publish ();
+        ring_->endWrite ();
+
+        return true;
+      }
+
+
+      /**
+       * @brief Stores  `args'  into  `entry',  deferred if possible  &  as text otherwise.
+       * @tparam TArgs
+       * @param entry
+       * @param format
+       * @param args
+       */
+      template <typename ... TArgs>
+      static void
+      store_ (entry_type & entry, const CString & format, const TArgs & ... args)
+      {
+        if constexpr (AsyncLoggerInternals_::AreDeferrableV_ <TArgs ...>)
+        {
+          using arguments_type = AsyncLoggerInternals_::DeferredArgumentsT_ <TArgs ...>;
+
+          std::size_t offset (sizeof (arguments_type));
+          if (! ((offset + ... + deferredSize_ (args)) > sizeof (entry.arguments)))
+          {
+            // Braces,  so the strings are copied in order.
+            ::new (entry.arguments) arguments_type { defer_ (entry, offset, args) ... };
+            entry.format_function = & formatArguments_ <TArgs ...>;
+
+            return;
+          }
+        }
+
+        const std::string text (fmt::format (format.data (), args ...));
+        entry.text_size = (text.size () < sizeof (entry.arguments)) ? text.size () : sizeof (entry.arguments);
+        text.copy (text_ (entry), entry.text_size);
+        entry.format_function = & formatText_;
+      }
+
+
+      /**
+       * @brief
+       * @tparam TArgs
+       * @param entry
+       * @param output
+       */
+      template <typename ... TArgs>
+      static void
+      formatArguments_ (const entry_type & entry, std::string & output)
+      {
+        using arguments_type = AsyncLoggerInternals_::DeferredArgumentsT_ <TArgs ...>;
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wold-style-cast"
+        const arguments_type & arguments (* std::launder ((const arguments_type *) entry.arguments));
+#pragma GCC diagnostic pop
+
+        output += std::apply (
+          [& entry] (const AsyncLoggerInternals_::DeferredT_ <TArgs> & ... args)
+          {
+            return fmt::format (entry.format, restore_ (entry, args) ...);
+          },
+          arguments
+        );
+      }
+
+
+      /**
+       * @brief
+       * @param entry
+       * @param output
+       */
+      static void
+      formatText_ (const entry_type & entry, std::string & output);
+
+
+      /**
+       * @brief
+       * @param string
+       * @return Number of characters of  `string'  up to the terminating null.
+       */
+      [[nodiscard]] static std::size_t
+      length_ (const CString & string) noexcept
+      {
+        return std::size_t (std::find (string.data (), string.data () + string.size (), '\0') - string.data ());
+      }
+
+
+      /**
+       * @brief
+       * @tparam TType
+       * @param arg
+       * @return Number of bytes  `arg'  needs past the arguments tuple.
+       */
+      template <typename TType>
+      [[nodiscard]] static std::size_t
+      deferredSize_ (const TType & arg [[maybe_unused]]) noexcept
+      {
+        if constexpr (std::is_same_v <TType, CString>)
+        {
+          return length_ (arg);
+        }
+        else
+        {
+          return 0;
+        }
+      }
+
+
+      /**
+       * @brief
+       * @tparam TType
+       * @param entry
+       * @param offset
+       * @param arg
+       * @return
+       */
+      template <typename TType>
+      [[nodiscard]] static const TType &
+      defer_ (entry_type & entry [[maybe_unused]], std::size_t & offset [[maybe_unused]], const TType & arg) noexcept
+      {
+        return arg;
+      }
+
+
+      /**
+       * @brief Copies the characters of  `string'  to  `offset'  in the arguments of  `entry'  &  advances  `offset'.
+       * @param entry
+       * @param offset
+       * @param string
+       * @return
+       */
+      [[nodiscard]] static AsyncLoggerInternals_::DeferredString_
+      defer_ (entry_type & entry, std::size_t & offset, const CString & string) noexcept
+      {
+        const AsyncLoggerInternals_::DeferredString_ deferred { offset, length_ (string) };
+        std::copy_n (string.data (), deferred.size, text_ (entry) + offset);
+        offset += deferred.size;
+
+        return deferred;
+      }
+
+
+      /**
+       * @brief
+       * @tparam TType
+       * @param entry
+       * @param arg
+       * @return
+       */
+      template <typename TType>
+      [[nodiscard]] static const TType &
+      restore_ (const entry_type & entry [[maybe_unused]], const TType & arg) noexcept
+      {
+        return arg;
+      }
+
+
+      /**
+       * @brief
+       * @param entry
+       * @param string
+       * @return
+       */
+      [[nodiscard]] static std::string_view
+      restore_ (const entry_type & entry, const AsyncLoggerInternals_::DeferredString_ & string) noexcept
+      {
+        return std::string_view (text_ (entry) + string.offset, string.size);
+      }
+
+
+      /**
+       * @brief
+       * @param entry
+       * @return
+       */
+      static char *
+      text_ (entry_type & entry) noexcept
+      {
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wold-style-cast"
+        return (char *) entry.arguments;
+#pragma GCC diagnostic pop
+      }
+
+
+      /**
+       * @brief
+       * @param entry
+       * @return
+       */
+      static const char *
+      text_ (const entry_type & entry) noexcept
+      {
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wold-style-cast"
+        return (const char *) entry.arguments;
+#pragma GCC diagnostic pop
+      }
+
+
+      /**
+       * @brief Gives the calling thread a ring,  a retired one if any has been drained.
+       * Rings outlive their threads,  so entries of finished threads still get written.
+       * @return  `nullptr'  if the calling thread has already retired its ring,  i. e. is exiting.
+       */
+      static ring_type *
+      registerRing_ ();
+
+      /**
+       * @brief Applies the overflow policy to the calling thread's full ring.
+       * @return A free slot,  or  `nullptr'  if the entry has to be dropped.
+       */
+      static entry_type *
+      acquireOnOverflow_ ();
+
+
+      /**
+       * @brief
+       */
+      inline static std::atomic <bool> is_running_ { };
+
+      /**
+       * @brief
+       */
+      inline static std::atomic <std::size_t> dropped_count_ { };
+
+      /**
+       * @brief
+       */
+      inline static thread_local ring_type * ring_ { };
+
+
+      /**
+       * @brief Retires the ring of its thread on thread exit.
+       */
+      struct RingOwner_;
+  };
+}
+
+
+#endif  // UTILS_LOGGING_ASYNCLOGGER_HXX
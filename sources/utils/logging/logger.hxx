@@ -4,6 +4,7 @@
 
 #include <cstddef>  // std::size_t
 
+#include <atomic>  // std::{atomic, memory_order_relaxed}
 #include <iostream>  // std::{clog, ostream}
 //#include <string_view>  // std::string_view
 
@@ -12,6 +13,9 @@
 
 #include "../containers/c-string.hxx"  // CString
 #include "../debug/source-location.hxx"  // SourceLocation
+#ifdef WITH_ASYNC_LOG
+#include "async-logger.hxx"  // AsyncLogger::{flush, log, log_Detailed, tryFlush}
+#endif  // WITH_ASYNC_LOG
 
 
 namespace Utils
@@ -58,11 +62,18 @@ namespace Utils
       static void
       log (const CString & prefix, const CString & format, const TArgs & ... args)
       {
-        ++ message_id_;
+        const std::size_t message_id (nextMessageId_ ());
+
+#ifdef WITH_ASYNC_LOG
+        if (AsyncLogger::log (message_id, prefix, format, args ...))
+        {
+          return;
+        }
+#endif  // WITH_ASYNC_LOG
 
         fmt::print (
           output_stream_, "{0:d}/{1:s} {2:s}\n",
-          message_id_, prefix, fmt::format (format.data (), args ...)
+          message_id, prefix, fmt::format (format.data (), args ...)
         );
       }
 
@@ -82,16 +93,51 @@ namespace Utils
         const CString & prefix, const CString & format, const TArgs & ... args
       )
       {
-        ++ message_id_;
+        const std::size_t message_id (nextMessageId_ ());
+
+#ifdef WITH_ASYNC_LOG
+        if (AsyncLogger::log_Detailed (message_id, source_location, prefix, format, args ...))
+        {
+          return;
+        }
+#endif  // WITH_ASYNC_LOG
 
         fmt::print (
           output_stream_, "{0:d}/{1:s} {2:s}  (in  `{3:s}'  at  `{4:s}:{5:d}')\n",
-          message_id_, prefix, fmt::format (format.data (), args ...),
+          message_id, prefix, fmt::format (format.data (), args ...),
           source_location.function (), source_location.file (), source_location.line ()
         );
       }
 
 
+      /**
+       * @brief Writes out everything that's been logged so far.
+       */
+      static void
+      flush () noexcept
+      {
+#ifdef WITH_ASYNC_LOG
+        AsyncLogger::flush ();
+#endif  // WITH_ASYNC_LOG
+
+        output_stream_.flush ();
+      }
+
+
+      /**
+       * @brief Same as  `flush',  but never blocks for long,  for the crash path  (see  `AsyncLogger::tryFlush').
+       */
+      static void
+      tryFlush () noexcept
+      {
+#ifdef WITH_ASYNC_LOG
+        AsyncLogger::tryFlush ();
+#endif  // WITH_ASYNC_LOG
+
+        output_stream_.flush ();
+      }
+
+
       /**
        * @brief
        * @param that
@@ -110,10 +156,21 @@ namespace Utils
 
 
     private:
+      /**
+       * @brief
+       * @return
+       */
+      static std::size_t
+      nextMessageId_ () noexcept
+      {
+        return message_id_.fetch_add (1, std::memory_order_relaxed) + 1;
+      }
+
+
       /**
        * @brief
        */
-      inline static std::size_t message_id_ { };
+      inline static std::atomic <std::size_t> message_id_ { };
 
       /**
        * @brief
@@ -0,0 +1,165 @@
+#ifndef UTILS_MEMORY_ARENAALLOCATOR_HXX
+#define UTILS_MEMORY_ARENAALLOCATOR_HXX
+
+
+#include <cstddef>  // std::size_t
+
+#include <new>  // std::bad_array_new_length
+
+#include "arena.hxx"  // Arena
+
+
+namespace Utils
+{
+  /**
+   * @brief Standard allocator backed by an  `Arena';  deallocation is a no-op.
+   * Containers using it must not outlive the arena's next  `reset'.
+   * Not  `final':  standard containers derive from their allocators.
+   * @tparam TValue
+   */
+  template <typename TValue>
+  class ArenaAllocator
+  {
+    template <typename TThatValue>
+    friend class ArenaAllocator;
+
+
+    public:
+      /**
+       * @brief
+       */
+      using value_type = TValue;
+
+
+    private:
+      /**
+       * @brief
+       */
+      using self_type = ArenaAllocator;
+
+
+    public:
+      /**
+       * @brief
+       */
+      ArenaAllocator () noexcept = delete;
+
+      /**
+       * @brief
+       * @param that
+       */
+      constexpr ArenaAllocator (const self_type & that [[maybe_unused]]) noexcept = default;
+
+      /**
+       * @brief
+       * @param that
+       */
+      constexpr ArenaAllocator (self_type && that [[maybe_unused]]) noexcept = default;
+
+
+      /**
+       * @brief
+       * @param arena
+       */
+      constexpr ArenaAllocator (Arena & arena) noexcept :
+        arena_ (& arena)
+      { }
+
+
+      /**
+       * @brief
+       * @tparam TThatValue
+       * @param that
+       */
+      template <typename TThatValue>
+      constexpr ArenaAllocator (const ArenaAllocator <TThatValue> & that) noexcept :
+        arena_ (that.arena_)
+      { }
+
+
+      /**
+       * @brief
+       * @param count
+       * @return
+       * @throws std::bad_alloc
+       */
+      [[nodiscard]] value_type *
+      allocate (std::size_t count)
+      {
+        if (count > std::size_t (-1) / sizeof (value_type))
+        {
+          throw std::bad_array_new_length ();
+        }
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wold-style-cast"
+        return (value_type *) arena_->allocate (count * sizeof (value_type), alignof (value_type));
+#pragma GCC diagnostic pop
+      }
+
+
+      /**
+       * @brief
+       * @param pointer
+       * @param count
+       */
+      void
+      deallocate (value_type * pointer [[maybe_unused]], std::size_t count [[maybe_unused]]) noexcept
+      { }
+
+
+      /**
+       * @brief
+       * @param that
+       * @return
+       */
+      constexpr self_type &
+      operator = (const self_type & that [[maybe_unused]]) noexcept = default;
+
+      /**
+       * @brief
+       * @param that
+       * @return
+       */
+      constexpr self_type &
+      operator = (self_type && that [[maybe_unused]]) noexcept = default;
+
+
+      /**
+       * @brief
+       * @tparam TThatValue
+       * @param that
+       * @return
+       */
+      template <typename TThatValue>
+      [[nodiscard]] constexpr bool
+      operator == (const ArenaAllocator <TThatValue> & that) const noexcept
+      {
+        return arena_ == that.arena_;
+      }
+
+
+      /**
+       * @brief
+       * @tparam TThatValue
+       * @param that
+       * @return
+       */
+      template <typename TThatValue>
+      [[nodiscard]] constexpr bool
+      operator != (const ArenaAllocator <TThatValue> & that) const noexcept
+      {
+        return ! operator == (that);
+      }
+
+
+    private:
+      /**
+       * @brief
+       */
+      Arena * arena_;
+  };
+}
+
+
+#endif  // UTILS_MEMORY_ARENAALLOCATOR_HXX
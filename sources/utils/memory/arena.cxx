@@ -0,0 +1,55 @@
+#include "arena.hxx"  // Arena
+
+#include <cstddef>  // std::{byte, size_t}
+
+#include <memory>  // std::unique_ptr
+
+
+namespace Utils
+{
+  Arena::Arena (std::size_t chunk_size) noexcept :
+    chunk_size_ (chunk_size)
+  { }
+
+
+  void
+  Arena::reset () noexcept
+  {
+    high_water_mark_ = highWaterMark ();
+    size_ = 0;
+    next_chunk_ = 0;
+    position_ = nullptr;
+    space_ = 0;
+  }
+
+
+  void *
+  Arena::allocateSlow_ (std::size_t size, std::size_t alignment)
+  {
+    const std::size_t required_size (size + alignment - 1);
+
+    while (next_chunk_ < chunks_.size ())
+    {
+      Chunk_ & chunk (chunks_ [next_chunk_]);
+      ++ next_chunk_;
+
+      if (! (chunk.size < required_size))
+      {
+        position_ = chunk.data.get ();
+        space_ = chunk.size;
+
+        return allocate (size, alignment);
+      }
+    }
+
+    const std::size_t chunk_size ((chunk_size_ < required_size) ? required_size : chunk_size_);
+    chunks_.push_back ({ std::unique_ptr <std::byte []> (new std::byte [chunk_size]), chunk_size });
+    capacity_ += chunk_size;
+    next_chunk_ = chunks_.size ();
+
+    position_ = chunks_.back ().data.get ();
+    space_ = chunk_size;
+
+    return allocate (size, alignment);
+  }
+}
@@ -0,0 +1,212 @@
+#ifndef UTILS_MEMORY_ARENA_HXX
+#define UTILS_MEMORY_ARENA_HXX
+
+
+#include <cstddef>  // std::{byte, max_align_t, size_t}
+
+#include <memory>  // std::{align, unique_ptr}
+#include <vector>  // std::vector
+
+#include "../config/arena.hxx"  // Config::Utils::Arena::Chunk_size
+
+
+namespace Utils
+{
+  /**
+   * @brief Bump-pointer allocator for objects sharing one lifetime,  e. g. a request.
+   * Individual deallocation is a no-op;  `reset'  releases everything at once  &  keeps the chunks for reuse,  so a
+   *   warmed-up arena doesn't call into the system allocator at all.  Not thread-safe.
+   * NOTE:  [2]  Doesn't call destructors!
+   */
+  class Arena final
+  {
+    private:
+      /**
+       * @brief
+       */
+      using self_type = Arena;
+
+
+    public:
+      /**
+       * @brief
+       */
+      Arena () noexcept = default;
+
+      /**
+       * @brief
+       * @param that
+       */
+      Arena (const self_type & that [[maybe_unused]]) noexcept = delete;
+
+      /**
+       * @brief
+       * @param that
+       */
+      Arena (self_type && that [[maybe_unused]]) noexcept = delete;
+
+
+      /**
+       * @brief
+       * @param chunk_size Size of the chunks requested from the system,  in bytes.
+       */
+      explicit Arena (std::size_t chunk_size) noexcept;
+
+
+      /**
+       * @brief
+       * @param size
+       * @param alignment Power of 2.
+       * @return
+       * @throws std::bad_alloc
+       */
+      [[nodiscard]] void *
+      allocate (std::size_t size, std::size_t alignment = alignof (std::max_align_t))
+      {
+        void * position (position_);
+        std::size_t space (space_);
+        if (std::align (alignment, size, position, space) != nullptr)
+        {
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wold-style-cast"
+          position_ = (std::byte *) position + size;
+#pragma GCC diagnostic pop
+          space_ = space - size;
+          size_ += size;
+
+          return position;
+        }
+
+        return allocateSlow_ (size, alignment);
+      }
+
+
+      /**
+       * @brief Releases all allocations,  keeping the chunks.
+       */
+      void
+      reset () noexcept;
+
+
+      /**
+       * @brief
+       * @return Bytes allocated since the last  `reset'.
+       */
+      [[nodiscard]] std::size_t
+      size () const noexcept
+      {
+        return size_;
+      }
+
+
+      /**
+       * @brief
+       * @return Bytes held in chunks.
+       */
+      [[nodiscard]] std::size_t
+      capacity () const noexcept
+      {
+        return capacity_;
+      }
+
+
+      /**
+       * @brief
+       * @return Maximum of  `size ()'  over the lifetime of the arena.
+       */
+      [[nodiscard]] std::size_t
+      highWaterMark () const noexcept
+      {
+        return (high_water_mark_ < size_) ? size_ : high_water_mark_;
+      }
+
+
+      /**
+       * @brief
+       * @param that
+       * @return
+       */
+      self_type &
+      operator = (const self_type & that [[maybe_unused]]) noexcept = delete;
+
+      /**
+       * @brief
+       * @param that
+       * @return
+       */
+      self_type &
+      operator = (self_type && that [[maybe_unused]]) noexcept = delete;
+
+
+    private:
+      /**
+       * @brief Moves to the next chunk that fits the allocation,  requesting a new one if there's none.
+       * @param size
+       * @param alignment
+       * @return
+       */
+      void *
+      allocateSlow_ (std::size_t size, std::size_t alignment);
+
+
+      /**
+       * @brief
+       */
+      struct Chunk_ final
+      {
+        /**
+         * @brief
+         */
+        std::unique_ptr <std::byte []> data;
+
+        /**
+         * @brief
+         */
+        std::size_t size;
+      };
+
+
+      /**
+       * @brief
+       */
+      std::size_t chunk_size_ { Config::Utils::Arena::Chunk_size };
+
+      /**
+       * @brief
+       */
+      std::vector <Chunk_> chunks_;
+
+      /**
+       * @brief Index of the chunk following the current one.
+       */
+      std::size_t next_chunk_ { };
+
+      /**
+       * @brief
+       */
+      std::byte * position_ { };
+
+      /**
+       * @brief Bytes left in the current chunk.
+       */
+      std::size_t space_ { };
+
+      /**
+       * @brief
+       */
+      std::size_t size_ { };
+
+      /**
+       * @brief
+       */
+      std::size_t capacity_ { };
+
+      /**
+       * @brief
+       */
+      std::size_t high_water_mark_ { };
+  };
+}
+
+
+#endif  // UTILS_MEMORY_ARENA_HXX
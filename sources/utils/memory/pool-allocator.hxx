@@ -0,0 +1,165 @@
+#ifndef UTILS_MEMORY_POOLALLOCATOR_HXX
+#define UTILS_MEMORY_POOLALLOCATOR_HXX
+
+
+#include <cstddef>  // std::size_t
+
+#include <new>  // std::{align_val_t, bad_array_new_length},  ::operator {delete, new}
+
+#include "../meta/aligned-storage.hxx"  // AlignedStorageT
+#include "pool.hxx"  // Pool
+
+
+namespace Utils
+{
+  /**
+   * @brief Standard allocator serving single-object allocations from the  `Pool'  of blocks of  `TValue's size  &
+   *   alignment  (node-based containers:  `std::list',  `std::map',  `std::set',  ...).
+   * Array allocations go to  `::operator new'.
+   * Not  `final':  standard containers derive from their allocators.
+   * @tparam TValue
+   */
+  template <typename TValue>
+  class PoolAllocator
+  {
+    public:
+      /**
+       * @brief
+       */
+      using value_type = TValue;
+
+      /**
+       * @brief
+       */
+      using pool_type = Pool <AlignedStorageT <sizeof (value_type), alignof (value_type)>>;
+
+
+    private:
+      /**
+       * @brief
+       */
+      using self_type = PoolAllocator;
+
+
+    public:
+      /**
+       * @brief
+       */
+      constexpr PoolAllocator () noexcept = default;
+
+      /**
+       * @brief
+       * @param that
+       */
+      constexpr PoolAllocator (const self_type & that [[maybe_unused]]) noexcept = default;
+
+      /**
+       * @brief
+       * @param that
+       */
+      constexpr PoolAllocator (self_type && that [[maybe_unused]]) noexcept = default;
+
+
+      /**
+       * @brief
+       * @tparam TThatValue
+       * @param that
+       */
+      template <typename TThatValue>
+      constexpr PoolAllocator (const PoolAllocator <TThatValue> & that [[maybe_unused]]) noexcept
+      { }
+
+
+      /**
+       * @brief
+       * @param count
+       * @return
+       * @throws std::bad_alloc
+       */
+      [[nodiscard]] value_type *
+      allocate (std::size_t count)
+      {
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wold-style-cast"
+        if (count == 1)
+        {
+          return (value_type *) pool_type::allocate ();
+        }
+
+        if (count > std::size_t (-1) / sizeof (value_type))
+        {
+          throw std::bad_array_new_length ();
+        }
+
+        return (value_type *) ::operator new (count * sizeof (value_type), std::align_val_t (alignof (value_type)));
+#pragma GCC diagnostic pop
+      }
+
+
+      /**
+       * @brief
+       * @param pointer
+       * @param count
+       */
+      void
+      deallocate (value_type * pointer, std::size_t count) noexcept
+      {
+        if (count == 1)
+        {
+          pool_type::deallocate (pointer);
+
+          return;
+        }
+
+        ::operator delete (pointer, std::align_val_t (alignof (value_type)));
+      }
+
+
+      /**
+       * @brief
+       * @param that
+       * @return
+       */
+      constexpr self_type &
+      operator = (const self_type & that [[maybe_unused]]) noexcept = default;
+
+      /**
+       * @brief
+       * @param that
+       * @return
+       */
+      constexpr self_type &
+      operator = (self_type && that [[maybe_unused]]) noexcept = default;
+
+
+      /**
+       * @brief
+       * @tparam TThatValue
+       * @param that
+       * @return All pool allocators are interchangeable.
+       */
+      template <typename TThatValue>
+      [[nodiscard]] constexpr bool
+      operator == (const PoolAllocator <TThatValue> & that [[maybe_unused]]) const noexcept
+      {
+        return true;
+      }
+
+
+      /**
+       * @brief
+       * @tparam TThatValue
+       * @param that
+       * @return
+       */
+      template <typename TThatValue>
+      [[nodiscard]] constexpr bool
+      operator != (const PoolAllocator <TThatValue> & that [[maybe_unused]]) const noexcept
+      {
+        return false;
+      }
+  };
+}
+
+
+#endif  // UTILS_MEMORY_POOLALLOCATOR_HXX
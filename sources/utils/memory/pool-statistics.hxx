@@ -0,0 +1,63 @@
+#ifndef UTILS_MEMORY_POOLSTATISTICS_HXX
+#define UTILS_MEMORY_POOLSTATISTICS_HXX
+
+
+#include <cstddef>  // std::size_t
+
+#include <ostream>  // std::ostream
+
+
+namespace Utils
+{
+  /**
+   * @brief Snapshot of a  `Pool'  state,  in blocks.
+   */
+  struct PoolStatistics final
+  {
+    /**
+     * @brief
+     */
+    std::size_t block_size;
+
+    /**
+     * @brief Blocks in all allocated slabs,  carved or not.
+     */
+    std::size_t capacity;
+
+    /**
+     * @brief Blocks handed out to threads,  including the ones cached in their magazines.
+     */
+    std::size_t in_use;
+
+    /**
+     * @brief Maximum of  `in_use'  over the lifetime of the pool.
+     */
+    std::size_t high_water_mark;
+
+    /**
+     * @brief
+     */
+    std::size_t slabs;
+
+
+    /**
+     * @brief
+     * @param output
+     * @param self
+     * @return
+     */
+    friend std::ostream &
+    operator << (std::ostream & output, const PoolStatistics & self)
+    {
+      output
+        << "PoolStatistics{block_size: " << self.block_size << ", capacity: " << self.capacity
+        << ", in_use: " << self.in_use << ", high_water_mark: " << self.high_water_mark
+        << ", slabs: " << self.slabs << '}';
+
+      return output;
+    }
+  };
+}
+
+
+#endif  // UTILS_MEMORY_POOLSTATISTICS_HXX
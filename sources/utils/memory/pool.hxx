@@ -0,0 +1,456 @@
+#ifndef UTILS_MEMORY_POOL_HXX
+#define UTILS_MEMORY_POOL_HXX
+
+
+#include <cstddef>  // std::{byte, size_t}
+
+#include <algorithm>  // std::copy
+#include <mutex>  // std::{lock_guard, mutex}
+#include <new>  // std::align_val_t,  ::operator new
+#include <type_traits>  // std::is_nothrow_destructible_v
+#include <utility>  // std::forward
+#include <vector>  // std::vector
+
+#include "../algorithms/max.hxx"  // max
+#include "../config/pool.hxx"  // Config::Utils::Pool::{Magazine_capacity, Slab_size}
+#include "../meta/aligned-union-storage.hxx"  // AlignedUnionStorageT
+#include "pool-statistics.hxx"  // PoolStatistics
+
+
+namespace Utils
+{
+  namespace PoolInternals_
+  {
+    /**
+     * @brief Free block,  linked through its own storage.
+     */
+    struct FreeBlock_ final
+    {
+      /**
+       * @brief
+       */
+      FreeBlock_ * next;
+    };
+  }
+
+
+  /**
+   * @brief Fixed-size block allocator shared by all objects whose storage fits  `TStorage'
+   *   (e. g.  `AlignedUnionStorageT <TTypes ...>').
+   * Blocks are carved out of  `Slab_size'  slabs  &  recycled through an intrusive free list.  Every thread caches up
+   *   to  `Magazine_capacity'  free blocks,  so the shared free list  (& its lock)  is touched only once per half a
+   *   magazine of allocations or deallocations.  Blocks may be freed by any thread.
+   * Slabs are never returned to the system:  the pool state is intentionally immortal,  so blocks can be freed
+   *   safely during static destruction.  Once the magazine of a thread is destroyed,  its later allocations  &
+   *   deallocations go straight to the shared free list.
+   * @tparam TStorage
+   */
+  template <typename TStorage>
+  class Pool final
+  {
+    public:
+      /**
+       * @brief
+       */
+      using storage_type = TStorage;
+
+
+      /**
+       * @brief
+       */
+      static constexpr std::size_t block_alignment {
+        max (alignof (storage_type), alignof (PoolInternals_::FreeBlock_))
+      };
+
+      /**
+       * @brief
+       */
+      static constexpr std::size_t block_size {
+        (max (sizeof (storage_type), sizeof (PoolInternals_::FreeBlock_)) + block_alignment - 1)
+          / block_alignment * block_alignment
+      };
+
+
+    private:
+      /**
+       * @brief
+       */
+      using self_type = Pool;
+
+      /**
+       * @brief
+       */
+      using free_block_type = PoolInternals_::FreeBlock_;
+
+
+      /**
+       * @brief
+       */
+      static constexpr std::size_t magazine_capacity_ { Config::Utils::Pool::Magazine_capacity };
+
+      /**
+       * @brief
+       */
+      static constexpr std::size_t batch_size_ { magazine_capacity_ / 2 };
+
+      static_assert (batch_size_ > 0);
+
+      /**
+       * @brief
+       */
+      static constexpr std::size_t blocks_per_slab_ {
+        (Config::Utils::Pool::Slab_size < block_size) ? 1 : (Config::Utils::Pool::Slab_size / block_size)
+      };
+
+
+      /**
+       * @brief State shared by all threads,  guarded by  `mutex'.
+       */
+      struct Central_ final
+      {
+        /**
+         * @brief
+         */
+        std::mutex mutex;
+
+        /**
+         * @brief
+         */
+        free_block_type * free_list { };
+
+        /**
+         * @brief Not yet carved part of the last slab.
+         */
+        std::byte * carve_first { };
+
+        /**
+         * @brief
+         */
+        std::byte * carve_last { };
+
+        /**
+         * @brief
+         */
+        std::vector <void *> slabs;
+
+        /**
+         * @brief
+         */
+        std::size_t capacity { };
+
+        /**
+         * @brief
+         */
+        std::size_t in_use { };
+
+        /**
+         * @brief
+         */
+        std::size_t high_water_mark { };
+      };
+
+
+      /**
+       * @brief Per-thread stack of free blocks;  returns them to the shared free list on thread exit.
+       */
+      struct Magazine_ final
+      {
+        /**
+         * @brief
+         */
+        ~ Magazine_ ()
+        {
+          release_ (blocks, count);
+          count = 0;
+          is_magazine_retired_ = true;
+        }
+
+
+        /**
+         * @brief
+         */
+        void * blocks [magazine_capacity_];
+
+        /**
+         * @brief
+         */
+        std::size_t count;
+      };
+
+
+    public:
+      /**
+       * @brief
+       */
+      Pool () noexcept = delete;
+
+      /**
+       * @brief
+       * @param that
+       */
+      Pool (const self_type & that [[maybe_unused]]) noexcept = delete;
+
+      /**
+       * @brief
+       * @param that
+       */
+      Pool (self_type && that [[maybe_unused]]) noexcept = delete;
+
+
+      /**
+       * @brief
+       * @return Uninitialized block of  `block_size'  bytes aligned to  `block_alignment'.
+       * @throws std::bad_alloc
+       */
+      [[nodiscard]] static void *
+      allocate ()
+      {
+        if (is_magazine_retired_)
+        {
+          void * block;
+          std::size_t count (0);
+          acquire_ (& block, count, 1);
+
+          return block;
+        }
+
+        Magazine_ & magazine (magazine_);
+        if (magazine.count == 0)
+        {
+          acquire_ (magazine.blocks, magazine.count, batch_size_);
+        }
+
+        -- magazine.count;
+
+        return magazine.blocks [magazine.count];
+      }
+
+
+      /**
+       * @brief
+       * @param block Block returned by  `allocate',  or  `nullptr'.
+       */
+      static void
+      deallocate (void * block) noexcept
+      {
+        if (block == nullptr)
+        {
+          return;
+        }
+
+        if (is_magazine_retired_)
+        {
+          release_ (& block, 1);
+
+          return;
+        }
+
+        Magazine_ & magazine (magazine_);
+        if (magazine.count == magazine_capacity_)
+        {
+          // Return the coldest half,  keep the most recently freed blocks.
+          release_ (magazine.blocks, batch_size_);
+          std::copy (magazine.blocks + batch_size_, magazine.blocks + magazine_capacity_, magazine.blocks);
+          magazine.count -= batch_size_;
+        }
+
+        magazine.blocks [magazine.count] = block;
+        ++ magazine.count;
+      }
+
+
+      /**
+       * @brief
+       * @tparam TType
+       * @tparam TArgs
+       * @param args
+       * @return
+       */
+      template <typename TType, typename ... TArgs>
+      [[nodiscard]] static TType *
+      construct (TArgs && ... args)
+      {
+        static_assert (! (sizeof (TType) > block_size));
+        static_assert (! (alignof (TType) > block_alignment));
+
+        void * const block (allocate ());
+        try
+        {
+          return ::new (block) (TType) (std::forward <TArgs> (args) ...);
+        }
+        catch (...)
+        {
+          deallocate (block);
+
+          throw;
+        }
+      }
+
+
+      /**
+       * @brief
+       * @tparam TType
+       * @param object Object created by  `construct',  or  `nullptr'.
+       */
+      template <typename TType>
+      static void
+      destroy (TType * object) noexcept
+      {
+        static_assert (std::is_nothrow_destructible_v <TType>);
+
+        if (object == nullptr)
+        {
+          return;
+        }
+
+        object->TType::~ TType ();
+        deallocate (object);
+      }
+
+
+      /**
+       * @brief
+       * @return
+       */
+      [[nodiscard]] static PoolStatistics
+      statistics ()
+      {
+        Central_ & central (central_ ());
+        const std::lock_guard <std::mutex> lock (central.mutex);
+
+        return { block_size, central.capacity, central.in_use, central.high_water_mark, central.slabs.size () };
+      }
+
+
+      /**
+       * @brief
+       * @param that
+       * @return
+       */
+      self_type &
+      operator = (const self_type & that [[maybe_unused]]) noexcept = delete;
+
+      /**
+       * @brief
+       * @param that
+       * @return
+       */
+      self_type &
+      operator = (self_type && that [[maybe_unused]]) noexcept = delete;
+
+
+    private:
+      /**
+       * @brief
+       * @return
+       */
+      static Central_ &
+      central_ ()
+      {
+        static Central_ & central (* new Central_ ());
+
+        return central;
+      }
+
+
+      /**
+       * @brief Pushes  `acquired_count'  blocks from the shared free list  (or fresh slabs)  onto the stack of
+       *   `count'  blocks at  `blocks';  on  `std::bad_alloc'  the blocks taken so far stay pushed.
+       * @param blocks
+       * @param count
+       * @param acquired_count
+       * @throws std::bad_alloc
+       */
+      static void
+      acquire_ (void ** blocks, std::size_t & count, std::size_t acquired_count)
+      {
+        Central_ & central (central_ ());
+        const std::lock_guard <std::mutex> lock (central.mutex);
+
+        for (std::size_t index (0); index < acquired_count; ++ index)
+        {
+          if (central.free_list != nullptr)
+          {
+            blocks [count] = central.free_list;
+            central.free_list = central.free_list->next;
+          }
+          else
+          {
+            if (central.carve_first == central.carve_last)
+            {
+              // Reserved first,  so  `push_back'  can't throw once the slab is allocated.
+              if (central.slabs.size () == central.slabs.capacity ())
+              {
+                central.slabs.reserve (max (2 * central.slabs.size (), std::size_t (1)));
+              }
+
+              void * const slab (::operator new (blocks_per_slab_ * block_size, std::align_val_t (block_alignment)));
+              central.slabs.push_back (slab);
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wold-style-cast"
+              central.carve_first = (std::byte *) slab;
+#pragma GCC diagnostic pop
+              central.carve_last = central.carve_first + blocks_per_slab_ * block_size;
+              central.capacity += blocks_per_slab_;
+            }
+
+            blocks [count] = central.carve_first;
+            central.carve_first += block_size;
+          }
+
+          ++ count;
+          ++ central.in_use;
+        }
+
+        central.high_water_mark = max (central.high_water_mark, central.in_use);
+      }
+
+
+      /**
+       * @brief Pushes  `count'  blocks to the shared free list.
+       * @param blocks
+       * @param count
+       */
+      static void
+      release_ (void * const * blocks, std::size_t count) noexcept
+      {
+        if (count == 0)
+        {
+          return;
+        }
+
+        Central_ & central (central_ ());
+        const std::lock_guard <std::mutex> lock (central.mutex);
+
+        for (std::size_t index (0); index < count; ++ index)
+        {
+          free_block_type * const block (::new (blocks [index]) (free_block_type) { central.free_list });
+          central.free_list = block;
+        }
+
+        central.in_use -= count;
+      }
+
+
+      /**
+       * @brief
+       */
+      inline static thread_local Magazine_ magazine_ { };
+
+      /**
+       * @brief Whether  `magazine_'  of this thread is already destroyed;  trivially destructible,  so it outlives
+       *   `magazine_'  during thread  (or static)  destruction.
+       */
+      inline static thread_local bool is_magazine_retired_ { false };
+  };
+
+
+  /**
+   * @brief Pool shared by all objects that fit the storage of  `AlignedUnion <TTypes ...>'.
+   */
+  template <typename ... TTypes>
+  using UnionPool = Pool <AlignedUnionStorageT <TTypes ...>>;
+}
+
+
+#endif  // UTILS_MEMORY_POOL_HXX
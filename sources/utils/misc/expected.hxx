@@ -280,26 +280,26 @@ namespace Utils
         /**
          * @brief
          */
-        constexpr Dummy_ (const self_type &) noexcept = delete;
+        constexpr Dummy_ (const self_type &) noexcept = default;
 
         /**
          * @brief
          */
-        constexpr Dummy_ (self_type &&) noexcept = delete;
+        constexpr Dummy_ (self_type &&) noexcept = default;
 
         /**
          * @brief
          * @return
          */
         constexpr Dummy_ &
-        operator = (const self_type &) noexcept = delete;
+        operator = (const self_type &) noexcept = default;
 
         /**
          * @brief
          * @return
          */
         constexpr Dummy_ &
-        operator = (self_type &&) noexcept = delete;
+        operator = (self_type &&) noexcept = default;
     };
 
 
@@ -351,16 +351,16 @@ namespace Utils
 
 
         /**
-         * @brief
+         * @brief Trivial if both members are trivially copyable,  deleted otherwise.
          * @param that
          */
-        constexpr ResultOrError_ (const self_type & that [[maybe_unused]]) noexcept = delete;
+        constexpr ResultOrError_ (const self_type & that [[maybe_unused]]) noexcept = default;
 
         /**
          * @brief
          * @param that
          */
-        constexpr ResultOrError_ (self_type && that [[maybe_unused]]) noexcept = delete;
+        constexpr ResultOrError_ (self_type && that [[maybe_unused]]) noexcept = default;
 
 
         /**
@@ -393,7 +393,7 @@ namespace Utils
          * @return
          */
         constexpr self_type &
-        operator = (const self_type & that [[maybe_unused]]) noexcept = delete;
+        operator = (const self_type & that [[maybe_unused]]) noexcept = default;
 
         /**
          * @brief
@@ -401,7 +401,7 @@ namespace Utils
          * @return
          */
         constexpr self_type &
-        operator = (self_type && that [[maybe_unused]]) noexcept = delete;
+        operator = (self_type && that [[maybe_unused]]) noexcept = default;
 
 
       private:
@@ -547,13 +547,14 @@ namespace Utils
 
 
     /**
-     * @brief
+     * @brief Result  or  error  &  the tag telling which one of them is alive.
+     * The tag goes first:  tail padding of a base class subobject may be reused,  so GCC can't assemble the
+     *   object in registers  (it spills it to the stack  &  reloads it instead)  if the tag leaves any.
      * @tparam TResult
      * @tparam TError
-     * @tparam TDerived
      */
-    template <typename TResult, typename TError, typename TDerived>
-    class ExpectedStorageBase_
+    template <typename TResult, typename TError>
+    class ExpectedStorageData_
     {
       static_assert (
            IsAllowedV_ <TResult>
@@ -572,68 +573,31 @@ namespace Utils
          */
         using error_type = TError;
 
-        /**
-         * @brief
-         */
-        using derived_type = TDerived;
-
 
       private:
         /**
          * @brief
          */
-        using self_type = ExpectedStorageBase_;
+        using self_type = ExpectedStorageData_;
 
 
       public:
         /**
          * @brief
          */
-        constexpr ExpectedStorageBase_ () noexcept = default;
-
+        constexpr ExpectedStorageData_ () noexcept = default;
 
         /**
          * @brief
          * @param that
          */
-        constexpr ExpectedStorageBase_ (const self_type & that)
-        noexcept (
-             std::is_nothrow_copy_constructible_v <result_type>
-          && std::is_nothrow_copy_constructible_v <error_type>
-        ) :
-          is_result_ (that.isResult_ ())
-        {
-          if (that.isResult_ ())
-          {
-            derived_ ()->construct_ (Result, that.get_ (Result));
-          }
-          else
-          {
-            derived_ ()->construct_ (Error, that.get_ (Error));
-          }
-        }
-
+        constexpr ExpectedStorageData_ (const self_type & that [[maybe_unused]]) noexcept = default;
 
         /**
          * @brief
          * @param that
          */
-        constexpr ExpectedStorageBase_ (self_type && that)
-        noexcept (
-             std::is_nothrow_move_constructible_v <result_type>
-          && std::is_nothrow_move_constructible_v <error_type>
-        ) :
-          is_result_ (that.isResult_ ())
-        {
-          if (that.isResult_ ())
-          {
-            derived_ ()->construct_ (Result, std::move (that.get_ (Result)));
-          }
-          else
-          {
-            derived_ ()->construct_ (Error, std::move (that.get_ (Error)));
-          }
-        }
+        constexpr ExpectedStorageData_ (self_type && that [[maybe_unused]]) noexcept = default;
 
 
         /**
@@ -642,7 +606,7 @@ namespace Utils
          * @param args
          */
         template <typename ... TArgs>
-        constexpr ExpectedStorageBase_ (ResultTag, TArgs && ... args)
+        constexpr ExpectedStorageData_ (ResultTag, TArgs && ... args)
         noexcept (std::is_nothrow_constructible_v <result_type, TArgs && ...>) :
           is_result_ (true),
           result_or_error_ (Result, std::forward <TArgs> (args) ...)
@@ -655,7 +619,7 @@ namespace Utils
          * @param args
          */
         template <typename ... TArgs>
-        constexpr ExpectedStorageBase_ (ErrorTag, TArgs && ... args)
+        constexpr ExpectedStorageData_ (ErrorTag, TArgs && ... args)
         noexcept (std::is_nothrow_constructible_v <error_type, TArgs && ...>) :
           is_result_ (false),
           result_or_error_ (Error, std::forward <TArgs> (args) ...)
@@ -817,6 +781,207 @@ namespace Utils
         { }
 
 
+      public:
+        /**
+         * @brief
+         * @param that
+         * @return
+         */
+        constexpr self_type &
+        operator = (const self_type & that [[maybe_unused]]) noexcept = default;
+
+        /**
+         * @brief
+         * @param that
+         * @return
+         */
+        constexpr self_type &
+        operator = (self_type && that [[maybe_unused]]) noexcept = default;
+
+
+      private:
+        /**
+         * @brief
+         */
+        bool is_result_;
+
+        /**
+         * @brief
+         */
+        ResultOrError_ <result_type, error_type> result_or_error_;
+    };
+
+
+    /**
+     * @brief Copies  &  moves the result  or  the error using  `TDerived's  construct_,  assign_  &  destroy_.
+     * @tparam TResult
+     * @tparam TError
+     * @tparam TDerived
+     * @tparam TIsTriviallyCopyable
+     */
+    template <
+      typename TResult, typename TError, typename TDerived,
+      bool TIsTriviallyCopyable =
+           std::is_trivially_copy_constructible_v <TResult>
+        && std::is_trivially_move_constructible_v <TResult>
+        && std::is_trivially_copy_assignable_v <TResult>
+        && std::is_trivially_move_assignable_v <TResult>
+        && std::is_trivially_destructible_v <TResult>
+        && std::is_trivially_copy_constructible_v <TError>
+        && std::is_trivially_move_constructible_v <TError>
+        && std::is_trivially_copy_assignable_v <TError>
+        && std::is_trivially_move_assignable_v <TError>
+        && std::is_trivially_destructible_v <TError>
+    >
+    class ExpectedStorageBase_ :
+      public ExpectedStorageData_ <TResult, TError>
+    {
+      static_assert (
+           IsAllowedV_ <TResult>
+        && IsAllowedV_ <TError>
+      );
+
+
+      public:
+        /**
+         * @brief
+         */
+        using result_type = TResult;
+
+        /**
+         * @brief
+         */
+        using error_type = TError;
+
+        /**
+         * @brief
+         */
+        using derived_type = TDerived;
+
+
+      private:
+        /**
+         * @brief
+         */
+        using self_type = ExpectedStorageBase_;
+
+        /**
+         * @brief
+         */
+        using data_type = ExpectedStorageData_ <result_type, error_type>;
+
+
+      public:
+        /**
+         * @brief
+         */
+        constexpr ExpectedStorageBase_ () noexcept = default;
+
+
+        /**
+         * @brief
+         * @param that
+         */
+        constexpr ExpectedStorageBase_ (const self_type & that)
+        noexcept (
+             std::is_nothrow_copy_constructible_v <result_type>
+          && std::is_nothrow_copy_constructible_v <error_type>
+        ) :
+          data_type ()
+        {
+          isResult_ (that.isResult_ ());
+
+          if (that.isResult_ ())
+          {
+            derived_ ()->construct_ (Result, that.get_ (Result));
+          }
+          else
+          {
+            derived_ ()->construct_ (Error, that.get_ (Error));
+          }
+        }
+
+
+        /**
+         * @brief
+         * @param that
+         */
+        constexpr ExpectedStorageBase_ (self_type && that)
+        noexcept (
+             std::is_nothrow_move_constructible_v <result_type>
+          && std::is_nothrow_move_constructible_v <error_type>
+        ) :
+          data_type ()
+        {
+          isResult_ (that.isResult_ ());
+
+          if (that.isResult_ ())
+          {
+            derived_ ()->construct_ (Result, std::move (that.get_ (Result)));
+          }
+          else
+          {
+            derived_ ()->construct_ (Error, std::move (that.get_ (Error)));
+          }
+        }
+
+
+        /**
+         * @brief
+         * @tparam TArgs
+         * @param args
+         */
+        template <typename ... TArgs>
+        constexpr ExpectedStorageBase_ (ResultTag, TArgs && ... args)
+        noexcept (std::is_nothrow_constructible_v <result_type, TArgs && ...>) :
+          data_type (Result, std::forward <TArgs> (args) ...)
+        { }
+
+
+        /**
+         * @brief
+         * @tparam TArgs
+         * @param args
+         */
+        template <typename ... TArgs>
+        constexpr ExpectedStorageBase_ (ErrorTag, TArgs && ... args)
+        noexcept (std::is_nothrow_constructible_v <error_type, TArgs && ...>) :
+          data_type (Error, std::forward <TArgs> (args) ...)
+        { }
+
+
+      protected:
+        /**
+         * @brief
+         */
+        using data_type::isResult_;
+
+        /**
+         * @brief
+         */
+        using data_type::get_;
+
+        /**
+         * @brief
+         */
+        using data_type::construct_;
+
+        /**
+         * @brief
+         */
+        using data_type::assign_;
+
+        /**
+         * @brief
+         */
+        using data_type::destroy_;
+
+        /**
+         * @brief
+         */
+        using data_type::clear_;
+
+
       public:
         /**
          * @brief
@@ -917,17 +1082,6 @@ namespace Utils
 
 
       private:
-        /**
-         * @brief
-         */
-        bool is_result_;
-
-        /**
-         * @brief
-         */
-        ResultOrError_ <result_type, error_type> result_or_error_;
-
-
         /**
          * @brief
          * @return
@@ -957,6 +1111,146 @@ namespace Utils
     };
 
 
+    /**
+     * @brief Trivially copies  &  moves,  so that  `Expected'  of trivially copyable types stays trivially copyable
+     *   &  is passed in registers.
+     * @tparam TResult
+     * @tparam TError
+     * @tparam TDerived
+     */
+    template <typename TResult, typename TError, typename TDerived>
+    class ExpectedStorageBase_ <TResult, TError, TDerived, true> :
+      public ExpectedStorageData_ <TResult, TError>
+    {
+      static_assert (
+           IsAllowedV_ <TResult>
+        && IsAllowedV_ <TError>
+      );
+
+
+      public:
+        /**
+         * @brief
+         */
+        using result_type = TResult;
+
+        /**
+         * @brief
+         */
+        using error_type = TError;
+
+        /**
+         * @brief
+         */
+        using derived_type = TDerived;
+
+
+      private:
+        /**
+         * @brief
+         */
+        using self_type = ExpectedStorageBase_;
+
+        /**
+         * @brief
+         */
+        using data_type = ExpectedStorageData_ <result_type, error_type>;
+
+
+      public:
+        /**
+         * @brief
+         */
+        constexpr ExpectedStorageBase_ () noexcept = default;
+
+        /**
+         * @brief
+         * @param that
+         */
+        constexpr ExpectedStorageBase_ (const self_type & that [[maybe_unused]]) noexcept = default;
+
+        /**
+         * @brief
+         * @param that
+         */
+        constexpr ExpectedStorageBase_ (self_type && that [[maybe_unused]]) noexcept = default;
+
+
+        /**
+         * @brief
+         * @tparam TArgs
+         * @param args
+         */
+        template <typename ... TArgs>
+        constexpr ExpectedStorageBase_ (ResultTag, TArgs && ... args)
+        noexcept (std::is_nothrow_constructible_v <result_type, TArgs && ...>) :
+          data_type (Result, std::forward <TArgs> (args) ...)
+        { }
+
+
+        /**
+         * @brief
+         * @tparam TArgs
+         * @param args
+         */
+        template <typename ... TArgs>
+        constexpr ExpectedStorageBase_ (ErrorTag, TArgs && ... args)
+        noexcept (std::is_nothrow_constructible_v <error_type, TArgs && ...>) :
+          data_type (Error, std::forward <TArgs> (args) ...)
+        { }
+
+
+      protected:
+        /**
+         * @brief
+         */
+        using data_type::isResult_;
+
+        /**
+         * @brief
+         */
+        using data_type::get_;
+
+        /**
+         * @brief
+         */
+        using data_type::construct_;
+
+        /**
+         * @brief
+         */
+        using data_type::assign_;
+
+        /**
+         * @brief
+         */
+        using data_type::destroy_;
+
+        /**
+         * @brief
+         */
+        using data_type::clear_;
+
+
+      public:
+        /**
+         * @brief
+         * @param that
+         * @return
+         */
+        constexpr self_type &
+        operator = (const self_type & that [[maybe_unused]]) noexcept = default;
+
+        /**
+         * @brief
+         * @param that
+         * @return
+         */
+        constexpr self_type &
+        operator = (self_type && that [[maybe_unused]]) noexcept = default;
+    };
+
+
     /**
      * @brief
      * @tparam TResult
@@ -3086,7 +3380,7 @@ namespace Utils
 
         base_type::isResult_ (that.isResult_ ());
 
-        base_type::wasChecked (false);
+        base_type::wasChecked_ (false);
         that.wasChecked_ (true);
 
         return * this;
@@ -3339,6 +3633,198 @@ namespace Utils
       }
 
 
+      /**
+       * @brief Calls  `function'  with the result;  it must return  `Expected'  with the same error type.
+       * @tparam TFunction
+       * @param function
+       * @return
+       */
+      template <typename TFunction>
+      [[nodiscard]] constexpr RemoveCVRefT <std::invoke_result_t <TFunction &&, const result_type &>>
+      andThen (TFunction && function) const &
+      noexcept (
+           std::is_nothrow_invocable_v <TFunction &&, const result_type &>
+        && std::is_nothrow_constructible_v <
+             RemoveCVRefT <std::invoke_result_t <TFunction &&, const result_type &>>, ErrorTag, const error_type &
+           >
+      )
+      {
+        using that_type = RemoveCVRefT <std::invoke_result_t <TFunction &&, const result_type &>>;
+
+
+        static_assert (std::is_same_v <typename that_type::error_type, error_type>);
+
+        base_type::wasChecked_ (true);
+
+        if (base_type::isResult_ ())
+        {
+          return std::forward <TFunction> (function) (base_type::result_ ());
+        }
+
+        return that_type (Error, base_type::error_ ());
+      }
+
+
+      /**
+       * @brief
+       * @tparam TFunction
+       * @param function
+       * @return
+       */
+      template <typename TFunction>
+      [[nodiscard]] constexpr RemoveCVRefT <std::invoke_result_t <TFunction &&, result_type &&>>
+      andThen (TFunction && function) &&
+      noexcept (
+           std::is_nothrow_invocable_v <TFunction &&, result_type &&>
+        && std::is_nothrow_constructible_v <
+             RemoveCVRefT <std::invoke_result_t <TFunction &&, result_type &&>>, ErrorTag, error_type &&
+           >
+      )
+      {
+        using that_type = RemoveCVRefT <std::invoke_result_t <TFunction &&, result_type &&>>;
+
+
+        static_assert (std::is_same_v <typename that_type::error_type, error_type>);
+
+        base_type::wasChecked_ (true);
+
+        if (base_type::isResult_ ())
+        {
+          return std::forward <TFunction> (function) (std::move (base_type::result_ ()));
+        }
+
+        return that_type (Error, std::move (base_type::error_ ()));
+      }
+
+
+      /**
+       * @brief Wraps what  `function'  returns for the result into  `Expected'  with the same error type.
+       * @tparam TFunction
+       * @param function
+       * @return
+       */
+      template <typename TFunction>
+      [[nodiscard]] constexpr Expected <
+        std::remove_cv_t <std::invoke_result_t <TFunction &&, const result_type &>>, error_type, safety_policy_type
+      >
+      transform (TFunction && function) const &
+      noexcept (
+           std::is_nothrow_invocable_v <TFunction &&, const result_type &>
+        && std::is_nothrow_constructible_v <error_type, const error_type &>
+      )
+      {
+        using that_type = Expected <
+          std::remove_cv_t <std::invoke_result_t <TFunction &&, const result_type &>>, error_type, safety_policy_type
+        >;
+
+
+        base_type::wasChecked_ (true);
+
+        if (base_type::isResult_ ())
+        {
+          return that_type (Result, std::forward <TFunction> (function) (base_type::result_ ()));
+        }
+
+        return that_type (Error, base_type::error_ ());
+      }
+
+
+      /**
+       * @brief
+       * @tparam TFunction
+       * @param function
+       * @return
+       */
+      template <typename TFunction>
+      [[nodiscard]] constexpr Expected <
+        std::remove_cv_t <std::invoke_result_t <TFunction &&, result_type &&>>, error_type, safety_policy_type
+      >
+      transform (TFunction && function) &&
+      noexcept (
+           std::is_nothrow_invocable_v <TFunction &&, result_type &&>
+        && std::is_nothrow_constructible_v <error_type, error_type &&>
+      )
+      {
+        using that_type = Expected <
+          std::remove_cv_t <std::invoke_result_t <TFunction &&, result_type &&>>, error_type, safety_policy_type
+        >;
+
+
+        base_type::wasChecked_ (true);
+
+        if (base_type::isResult_ ())
+        {
+          return that_type (Result, std::forward <TFunction> (function) (std::move (base_type::result_ ())));
+        }
+
+        return that_type (Error, std::move (base_type::error_ ()));
+      }
+
+
+      /**
+       * @brief Calls  `function'  with the error;  it must return  `Expected'  with the same result type.
+       * @tparam TFunction
+       * @param function
+       * @return
+       */
+      template <typename TFunction>
+      [[nodiscard]] constexpr RemoveCVRefT <std::invoke_result_t <TFunction &&, const error_type &>>
+      orElse (TFunction && function) const &
+      noexcept (
+           std::is_nothrow_invocable_v <TFunction &&, const error_type &>
+        && std::is_nothrow_constructible_v <
+             RemoveCVRefT <std::invoke_result_t <TFunction &&, const error_type &>>, ResultTag, const result_type &
+           >
+      )
+      {
+        using that_type = RemoveCVRefT <std::invoke_result_t <TFunction &&, const error_type &>>;
+
+
+        static_assert (std::is_same_v <typename that_type::result_type, result_type>);
+
+        base_type::wasChecked_ (true);
+
+        if (base_type::isResult_ ())
+        {
+          return that_type (Result, base_type::result_ ());
+        }
+
+        return std::forward <TFunction> (function) (base_type::error_ ());
+      }
+
+
+      /**
+       * @brief
+       * @tparam TFunction
+       * @param function
+       * @return
+       */
+      template <typename TFunction>
+      [[nodiscard]] constexpr RemoveCVRefT <std::invoke_result_t <TFunction &&, error_type &&>>
+      orElse (TFunction && function) &&
+      noexcept (
+           std::is_nothrow_invocable_v <TFunction &&, error_type &&>
+        && std::is_nothrow_constructible_v <
+             RemoveCVRefT <std::invoke_result_t <TFunction &&, error_type &&>>, ResultTag, result_type &&
+           >
+      )
+      {
+        using that_type = RemoveCVRefT <std::invoke_result_t <TFunction &&, error_type &&>>;
+
+
+        static_assert (std::is_same_v <typename that_type::result_type, result_type>);
+
+        base_type::wasChecked_ (true);
+
+        if (base_type::isResult_ ())
+        {
+          return that_type (Result, std::move (base_type::result_ ()));
+        }
+
+        return std::forward <TFunction> (function) (std::move (base_type::error_ ()));
+      }
+
+
       /**
        * @brief
        * @param that
@@ -3534,6 +4020,34 @@ namespace Utils
         return output;
       }
   };
+
+
+  namespace ExpectedInternals_
+  {
+    // Small trivially copyable instances must be passed in registers just like a hand-written  {result, error}.
+    static_assert (
+         std::is_trivially_copyable_v <Expected <int, int>>
+      && std::is_trivially_destructible_v <Expected <int, int>>
+      && sizeof (Expected <int, int>) == 2 * sizeof (int)
+    );
+
+
+    /**
+     * @brief Typical small error code.
+     */
+    enum struct ErrorCode_ : unsigned char
+    {
+      Failed = 1,
+    };
+
+
+    // Same for a one-byte error code:  the discriminant fits into the padding.
+    static_assert (
+         std::is_trivially_copyable_v <Expected <int, ErrorCode_>>
+      && std::is_trivially_destructible_v <Expected <int, ErrorCode_>>
+      && sizeof (Expected <int, ErrorCode_>) == 2 * sizeof (int)
+    );
+  }
 }
 
 
@@ -2,12 +2,17 @@
 #define UTILS_MISC_FLAGS_HXX
 
 
+#include <cstddef>  // std::{ptrdiff_t, size_t}
+
 #include <initializer_list> // std::initializer_list
 #include <ios>  // std::{hex, showbase}
+#include <iterator>  // std::forward_iterator_tag
 #include <limits>  // std::numeric_limits
 #include <ostream>  // std::ostream
 #include <type_traits>  // std::{is_enum_v, is_unsigned_v, underlying_type_t}
 
+#include "../algorithms/popcount.hxx"  // popcount
+
 
 namespace Utils
 {
@@ -28,13 +33,13 @@ namespace Utils
        */
       using flag_type = TFlag;
 
-
-    private:
       /**
        * @brief
        */
       using underlying_type = std::underlying_type_t <flag_type>;
 
+
+    private:
       /**
        * @brief
        */
@@ -42,6 +47,125 @@ namespace Utils
 
 
     public:
+      /**
+       * @brief Visits the set bits of  `Flags'  from the lowest to the highest one,  yielding each as a single flag.
+       * Every step clears the lowest set bit,  so iteration costs one step per set bit regardless of the width.
+       */
+      class const_iterator final
+      {
+        public:
+          /**
+           * @brief
+           */
+          using iterator_category = std::forward_iterator_tag;
+
+          /**
+           * @brief
+           */
+          using value_type = flag_type;
+
+          /**
+           * @brief
+           */
+          using difference_type = std::ptrdiff_t;
+
+          /**
+           * @brief
+           */
+          using pointer = const flag_type *;
+
+          /**
+           * @brief
+           */
+          using reference = flag_type;
+
+
+        public:
+          /**
+           * @brief
+           */
+          constexpr const_iterator () noexcept = default;
+
+
+          /**
+           * @brief
+           * @param rest
+           */
+          constexpr explicit const_iterator (underlying_type rest) noexcept :
+            rest_ (rest)
+          { }
+
+
+          /**
+           * @brief
+           * @return The lowest set bit.
+           */
+          [[nodiscard]] constexpr reference
+          operator * () const noexcept
+          {
+            return flag_type (underlying_type (rest_ & underlying_type (- rest_)));
+          }
+
+
+          /**
+           * @brief
+           * @return
+           */
+          constexpr const_iterator &
+          operator ++ () noexcept
+          {
+            rest_ = underlying_type (rest_ & underlying_type (rest_ - 1));
+
+            return * this;
+          }
+
+
+          /**
+           * @brief
+           * @return
+           */
+          constexpr const_iterator
+          operator ++ (int) noexcept
+          {
+            const const_iterator previous (* this);
+            ++ * this;
+
+            return previous;
+          }
+
+
+          /**
+           * @brief
+           * @param that
+           * @return
+           */
+          [[nodiscard]] constexpr bool
+          operator == (const const_iterator & that) const noexcept
+          {
+            return rest_ == that.rest_;
+          }
+
+
+          /**
+           * @brief
+           * @param that
+           * @return
+           */
+          [[nodiscard]] constexpr bool
+          operator != (const const_iterator & that) const noexcept
+          {
+            return ! operator == (that);
+          }
+
+
+        private:
+          /**
+           * @brief Bits not visited yet.
+           */
+          underlying_type rest_ { };
+      };
+
+
       /**
        * @brief
        */
@@ -215,6 +339,39 @@ namespace Utils
       }
 
 
+      /**
+       * @brief
+       * @return Number of set bits.
+       */
+      [[nodiscard]] constexpr std::size_t
+      count () const noexcept
+      {
+        return popcount (underlying_type (flags_));
+      }
+
+
+      /**
+       * @brief
+       * @return
+       */
+      [[nodiscard]] constexpr const_iterator
+      begin () const noexcept
+      {
+        return const_iterator (underlying_type (flags_));
+      }
+
+
+      /**
+       * @brief
+       * @return
+       */
+      [[nodiscard]] constexpr const_iterator
+      end () const noexcept
+      {
+        return const_iterator ();
+      }
+
+
       /**
        * @brief
        * @return
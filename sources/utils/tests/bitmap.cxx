@@ -0,0 +1,108 @@
+#include <cstddef>  // std::size_t
+
+#include <iostream>  // std::cerr
+#include <utility>  // std::move
+
+#include <fmt/format.h>  // fmt::print
+#include <fmt/ostream.h>  // fmt::print[std::ostream]
+
+#include "../containers/bitmap.hxx"  // Bitmap
+
+
+namespace
+{
+  /**
+   * @brief More than a word,  with a partial last word.
+   */
+  constexpr std::size_t Size (200);
+
+
+  /**
+   * @brief
+   * @return Bitmap of  `Size'  bits with every third bit set.
+   */
+  Utils::Bitmap
+  makeBitmap ()
+  {
+    Utils::Bitmap bitmap (Size);
+    for (std::size_t index (0); index < Size; index += 3)
+    {
+      bitmap.set (index);
+    }
+
+    return bitmap;
+  }
+
+
+  /**
+   * @brief
+   * @param bitmap
+   * @param name
+   * @return Whether  `bitmap'  is empty  &  all queries on it agree.
+   */
+  bool
+  checkEmpty (const Utils::Bitmap & bitmap, const char * name)
+  {
+    if (
+      (bitmap.size () != 0) || bitmap.any () || ! bitmap.none () || (bitmap.count () != 0)
+      || (bitmap.findFirst () != 0) || (bitmap.findNext (5) != 0)
+    )
+    {
+      fmt::print (std::cerr, "{0:s}:  moved-from bitmap isn't empty\n", name);
+      return false;
+    }
+
+    return true;
+  }
+
+
+  /**
+   * @brief
+   * @param bitmap
+   * @param name
+   * @return Whether  `bitmap'  equals  `makeBitmap ()'.
+   */
+  bool
+  checkMoved (const Utils::Bitmap & bitmap, const char * name)
+  {
+    if ((bitmap != makeBitmap ()) || (bitmap.count () != (Size + 2) / 3) || (bitmap.findNext (1) != 3))
+    {
+      fmt::print (std::cerr, "{0:s}:  moved-to bitmap differs from the source\n", name);
+      return false;
+    }
+
+    return true;
+  }
+}
+
+
+int
+main ()
+{
+  bool is_ok (true);
+
+  {
+    Utils::Bitmap source (makeBitmap ());
+    const Utils::Bitmap target (std::move (source));
+    is_ok = checkEmpty (source, "move constructor") && is_ok;
+    is_ok = checkMoved (target, "move constructor") && is_ok;
+  }
+
+  {
+    Utils::Bitmap source (makeBitmap ());
+    Utils::Bitmap target (Size / 2, true);
+    target = std::move (source);
+    is_ok = checkEmpty (source, "move assignment") && is_ok;
+    is_ok = checkMoved (target, "move assignment") && is_ok;
+
+    source.resize (Size);
+    source.set (Size - 1);
+    if ((source.count () != 1) || (source.findFirst () != Size - 1))
+    {
+      fmt::print (std::cerr, "move assignment:  moved-from bitmap isn't reusable\n");
+      is_ok = false;
+    }
+  }
+
+  return is_ok ? 0 : 1;
+}
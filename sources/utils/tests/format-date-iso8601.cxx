@@ -0,0 +1,73 @@
+#include <cstddef>  // std::size_t
+#include <cstdlib>  // ::setenv
+#include <ctime>  // std::time_t
+
+#include <iostream>  // std::cerr
+#include <limits>  // std::numeric_limits
+#include <string>  // std::string
+
+#include <time.h>  // ::tzset
+
+#include <fmt/format.h>  // fmt::print
+#include <fmt/ostream.h>  // fmt::print[std::ostream]
+
+#include "../date-time/format-date-iso8601.hxx"  // Date_Iso8601_max_size,  formatDate_Iso8601
+
+
+namespace
+{
+  /**
+   * @brief
+   */
+  struct Case final
+  {
+    /**
+     * @brief
+     */
+    std::time_t time;
+
+    /**
+     * @brief
+     */
+    const char * expected;
+  };
+
+
+  /**
+   * @brief Years at  &  beyond the ends of  [0; 9999]  &  the ends of  `std::time_t',  in UTC.
+   * The first case is formatted on a fresh cache.
+   */
+  constexpr Case Cases [] {
+    { std::numeric_limits <std::time_t>::min (), "-292277022657-01-27T08:29:52.000000001Z" },
+    { 0, "1970-01-01T00:00:00.000000001Z" },
+    { - 62'167'219'200, "0000-01-01T00:00:00.000000001Z" },
+    { - 62'167'219'201, "-000001-12-31T23:59:59.000000001Z" },
+    { 253'402'300'799, "9999-12-31T23:59:59.000000001Z" },
+    { 253'402'300'800, "+010000-01-01T00:00:00.000000001Z" },
+    { - 9'223'372'036'854'775'807, "-292277022657-01-27T08:29:53.000000001Z" },
+    { std::numeric_limits <std::time_t>::max (), "+292277026596-12-04T15:30:07.000000001Z" },
+  };
+}
+
+
+int
+main ()
+{
+  ::setenv ("TZ", "UTC", 1);
+  ::tzset ();
+
+  bool is_ok (true);
+  for (const Case & test_case : Cases)
+  {
+    char buffer [Utils::Date_Iso8601_max_size];
+    const char * const last (Utils::formatDate_Iso8601 (test_case.time, 1, 9, buffer));
+    const std::string date (buffer, std::size_t (last - buffer));
+    if (date != test_case.expected)
+    {
+      fmt::print (std::cerr, "{0:d}:  `{1:s}'  instead of  `{2:s}'\n", test_case.time, date, test_case.expected);
+      is_ok = false;
+    }
+  }
+
+  return is_ok ? 0 : 1;
+}
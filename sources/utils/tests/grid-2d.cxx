@@ -0,0 +1,250 @@
+#include <cmath>  // std::abs
+#include <cstddef>  // std::size_t
+#include <cstdint>  // std::uint64_t
+
+#include <iostream>  // std::cerr
+#include <random>  // std::{mt19937_64, uniform_real_distribution}
+#include <vector>  // std::vector
+
+#include <fmt/format.h>  // fmt::print
+#include <fmt/ostream.h>  // fmt::print[std::ostream]
+
+#include "../algorithms/lerp-2d.hxx"  // lerp_2d
+#include "../config/grid-2d.hxx"  // Config::Utils::Grid2d::Parallel_chunk_size
+#include "../containers/grid-2d.hxx"  // Grid2d
+
+
+namespace
+{
+  /**
+   * @brief
+   */
+  constexpr std::size_t Columns (5);
+
+  /**
+   * @brief
+   */
+  constexpr std::size_t Rows (4);
+
+  /**
+   * @brief More than one parallel chunk  &  not a multiple of the batch lanes.
+   */
+  constexpr std::size_t Points_count (3 * Config::Utils::Grid2d::Parallel_chunk_size + 7);
+
+  /**
+   * @brief
+   */
+  constexpr std::uint64_t Seed (0x5eed);
+
+
+  /**
+   * @brief
+   * @tparam TValue
+   */
+  template <typename TValue>
+  struct Points final
+  {
+    /**
+     * @brief
+     */
+    std::vector <TValue> xs;
+
+    /**
+     * @brief
+     */
+    std::vector <TValue> ys;
+  };
+
+
+  /**
+   * @brief Grid over  [-1; 3] x [0; 6]  sampling a function that isn't bilinear.
+   * @tparam TValue
+   * @return
+   */
+  template <typename TValue>
+  Utils::Grid2d <TValue>
+  makeGrid ()
+  {
+    std::vector <TValue> values (Columns * Rows);
+    for (std::size_t row (0); row < Rows; ++ row)
+    {
+      for (std::size_t column (0); column < Columns; ++ column)
+      {
+        const TValue c ((TValue (column)));
+        const TValue r ((TValue (row)));
+        values [row * Columns + column] = c * c - TValue (2) * r + TValue (0.5) * c * r * r;
+      }
+    }
+
+    return Utils::Grid2d <TValue> (TValue (- 1), TValue (3), Columns, TValue (0), TValue (6), Rows, std::move (values));
+  }
+
+
+  /**
+   * @brief Grid nodes,  points on the grid lines  &  interior points,  the latter filling up to  `Points_count'.
+   * @tparam TValue
+   * @param grid
+   * @return
+   */
+  template <typename TValue>
+  Points <TValue>
+  makePoints (const Utils::Grid2d <TValue> & grid)
+  {
+    std::mt19937_64 engine (Seed);
+    std::uniform_real_distribution <TValue> xs (grid.x (0), grid.x (Columns - 1));
+    std::uniform_real_distribution <TValue> ys (grid.y (0), grid.y (Rows - 1));
+
+    Points <TValue> points;
+    const auto add (
+      [& points] (TValue x, TValue y)
+      {
+        points.xs.push_back (x);
+        points.ys.push_back (y);
+      }
+    );
+
+    for (std::size_t row (0); row < Rows; ++ row)
+    {
+      for (std::size_t column (0); column < Columns; ++ column)
+      {
+        add (grid.x (column), grid.y (row));
+      }
+    }
+
+    for (std::size_t column (0); column < Columns; ++ column)
+    {
+      add (grid.x (column), ys (engine));
+    }
+
+    for (std::size_t row (0); row < Rows; ++ row)
+    {
+      add (xs (engine), grid.y (row));
+    }
+
+    while (points.xs.size () < Points_count)
+    {
+      add (xs (engine), ys (engine));
+    }
+
+    return points;
+  }
+
+
+  /**
+   * @brief Finds the cell by a linear search  &  interpolates with  `lerp_2d'  directly.
+   * @tparam TValue
+   * @param grid
+   * @param x
+   * @param y
+   * @return
+   */
+  template <typename TValue>
+  TValue
+  expectedAt (const Utils::Grid2d <TValue> & grid, TValue x, TValue y)
+  {
+    std::size_t column (0);
+    while ((column + 2 < Columns) && ! (x < grid.x (column + 1)))
+    {
+      ++ column;
+    }
+
+    std::size_t row (0);
+    while ((row + 2 < Rows) && ! (y < grid.y (row + 1)))
+    {
+      ++ row;
+    }
+
+    return Utils::lerp_2d (
+      x, y,
+      grid.x (column), grid.x (column + 1), grid.y (row), grid.y (row + 1),
+      grid.at (column, row), grid.at (column, row + 1), grid.at (column + 1, row + 1), grid.at (column + 1, row)
+    );
+  }
+
+
+  /**
+   * @brief
+   * @tparam TValue
+   * @param type_name
+   * @param tolerance Absolute;  the values are of order  10.
+   * @return Whether  `interpolate',  its batch kernel  &  `interpolate_Parallel'  all match  `lerp_2d'.
+   */
+  template <typename TValue>
+  bool
+  checkInterpolation (const char * type_name, TValue tolerance)
+  {
+    const Utils::Grid2d <TValue> grid (makeGrid <TValue> ());
+    const Points <TValue> points (makePoints (grid));
+    const std::size_t count (points.xs.size ());
+
+    std::vector <TValue> batch (count);
+    grid.interpolate (points.xs.data (), points.ys.data (), count, batch.data ());
+
+    // In place,  as  `out'  may alias  `xs'.
+    std::vector <TValue> in_place (points.xs);
+    grid.interpolate (in_place.data (), points.ys.data (), count, in_place.data ());
+
+    std::vector <TValue> parallel (count);
+    grid.interpolate_Parallel (points.xs.data (), points.ys.data (), count, parallel.data ());
+
+    bool is_ok (true);
+    for (std::size_t index (0); index < count; ++ index)
+    {
+      const TValue x (points.xs [index]);
+      const TValue y (points.ys [index]);
+      const TValue expected (expectedAt (grid, x, y));
+      const TValue scalar (grid.interpolate (x, y));
+
+      const char * path (nullptr);
+      if (std::abs (scalar - expected) > tolerance)
+      {
+        path = "interpolate";
+      }
+      else if (std::abs (batch [index] - expected) > tolerance)
+      {
+        path = "batch interpolate";
+      }
+      else if (std::abs (in_place [index] - expected) > tolerance)
+      {
+        path = "in-place batch interpolate";
+      }
+      else if (std::abs (parallel [index] - expected) > tolerance)
+      {
+        path = "interpolate_Parallel";
+      }
+
+      if (path != nullptr)
+      {
+        fmt::print (std::cerr, "{0:s}:  {1:s}  is off at  ({2}, {3})\n", type_name, path, x, y);
+        is_ok = false;
+        break;
+      }
+    }
+
+    for (std::size_t row (0); is_ok && (row < Rows); ++ row)
+    {
+      for (std::size_t column (0); column < Columns; ++ column)
+      {
+        if (std::abs (grid.interpolate (grid.x (column), grid.y (row)) - grid.at (column, row)) > tolerance)
+        {
+          fmt::print (std::cerr, "{0:s}:  node  ({1:d}, {2:d})  isn't reproduced\n", type_name, column, row);
+          is_ok = false;
+          break;
+        }
+      }
+    }
+
+    return is_ok;
+  }
+}
+
+
+int
+main ()
+{
+  bool is_ok (true);
+  is_ok = checkInterpolation <float> ("float", 1e-4f) && is_ok;
+  is_ok = checkInterpolation <double> ("double", 1e-12) && is_ok;
+
+  return is_ok ? 0 : 1;
+}
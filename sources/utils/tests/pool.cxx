@@ -0,0 +1,129 @@
+#include <cstddef>  // std::{byte, size_t}
+#include <cstdlib>  // std::_Exit
+
+#include <iostream>  // std::cerr
+#include <set>  // std::set
+#include <thread>  // std::thread
+#include <vector>  // std::vector
+
+#include <fmt/format.h>  // fmt::print
+#include <fmt/ostream.h>  // fmt::print[std::ostream]
+
+#include "../memory/pool.hxx"  // Pool
+
+
+namespace
+{
+  /**
+   * @brief
+   */
+  struct alignas (16) Block final
+  {
+    /**
+     * @brief
+     */
+    std::byte bytes [48];
+  };
+
+
+  /**
+   * @brief
+   */
+  using BlockPool = Utils::Pool <Block>;
+
+
+  /**
+   * @brief More than a magazine,  so stale magazine entries would be handed out again.
+   */
+  constexpr std::size_t Blocks_count (200);
+
+
+  /**
+   * @brief Allocates  `Blocks_count'  blocks,  frees them  &  allocates them again.
+   * @return Whether every allocation returned a block that isn't allocated already.
+   */
+  bool
+  churn ()
+  {
+    std::vector <void *> blocks;
+    std::set <void *> unique_blocks;
+    for (std::size_t round (0); round < 2; ++ round)
+    {
+      for (std::size_t index (0); index < Blocks_count; ++ index)
+      {
+        blocks.push_back (BlockPool::allocate ());
+        unique_blocks.insert (blocks.back ());
+      }
+
+      if (unique_blocks.size () != blocks.size ())
+      {
+        return false;
+      }
+
+      for (void * const block : blocks)
+      {
+        BlockPool::deallocate (block);
+      }
+
+      blocks.clear ();
+      unique_blocks.clear ();
+    }
+
+    return true;
+  }
+
+
+  /**
+   * @brief Uses the pool when destroyed,  i. e. after the magazine of its thread if it was constructed first.
+   */
+  struct LateUser final
+  {
+    /**
+     * @brief
+     */
+    ~ LateUser ()
+    {
+      if (! churn ())
+      {
+        fmt::print (std::cerr, "{0:s}:  a block was handed out twice after the magazine was destroyed\n", name);
+        std::_Exit (1);
+      }
+    }
+
+
+    /**
+     * @brief
+     */
+    const char * name;
+  };
+
+
+  /**
+   * @brief Destroyed after the thread-locals of the main thread.
+   */
+  LateUser late_static_user { "static" };
+}
+
+
+int
+main ()
+{
+  std::thread thread (
+    [] ()
+    {
+      thread_local LateUser late_thread_user { "thread_local" };
+      if (! churn ())
+      {
+        std::_Exit (1);
+      }
+    }
+  );
+  thread.join ();
+
+  if (! churn ())
+  {
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,281 @@
+#include <cmath>  // std::{abs, sqrt}
+#include <cstddef>  // std::size_t
+#include <cstdint>  // std::uint64_t
+
+#include <iostream>  // std::{cerr, cout}
+#include <limits>  // std::numeric_limits
+#include <random>  // std::{gamma_distribution, mt19937_64}
+#include <vector>  // std::vector
+
+#include <fmt/format.h>  // fmt::print
+#include <fmt/ostream.h>  // fmt::print[std::ostream]
+
+#include "../algorithms/running-stats.hxx"  // RunningStats
+#include "../algorithms/stats.hxx"  // stats
+#include "../config/running-stats.hxx"  // Config::Utils::RunningStats::{Block_size, Parallel_threshold}
+
+
+namespace
+{
+  /**
+   * @brief Wide enough for the two-pass reference.
+   */
+  using reference_type = long double;
+
+
+  /**
+   * @brief Above  `Parallel_threshold',  so  `stats'  takes its parallel path,  &  not a multiple of  `Block_size'.
+   */
+  constexpr std::size_t Values_count (Config::Utils::RunningStats::Parallel_threshold + 12345);
+
+  /**
+   * @brief
+   */
+  constexpr std::uint64_t Seed (0x5eed);
+
+
+  /**
+   * @brief Statistics computed in two passes in  `reference_type'.
+   */
+  struct Reference final
+  {
+    /**
+     * @brief
+     */
+    reference_type mean;
+
+    /**
+     * @brief
+     */
+    reference_type variance;
+
+    /**
+     * @brief
+     */
+    reference_type skewness;
+
+    /**
+     * @brief
+     */
+    reference_type kurtosis;
+
+    /**
+     * @brief
+     */
+    reference_type minimum;
+
+    /**
+     * @brief
+     */
+    reference_type maximum;
+  };
+
+
+  /**
+   * @brief
+   * @tparam TValue
+   * @param values
+   * @return
+   */
+  template <typename TValue>
+  Reference
+  makeReference (const std::vector <TValue> & values)
+  {
+    reference_type sum (0);
+    reference_type minimum (std::numeric_limits <reference_type>::infinity ());
+    reference_type maximum (- std::numeric_limits <reference_type>::infinity ());
+    for (const TValue value : values)
+    {
+      sum += value;
+      minimum = (value < minimum) ? value : minimum;
+      maximum = (maximum < value) ? value : maximum;
+    }
+
+    const reference_type n (reference_type (values.size ()));
+    const reference_type mean (sum / n);
+
+    reference_type m_2 (0);
+    reference_type m_3 (0);
+    reference_type m_4 (0);
+    for (const TValue value : values)
+    {
+      const reference_type delta (value - mean);
+      m_2 += delta * delta;
+      m_3 += delta * delta * delta;
+      m_4 += delta * delta * delta * delta;
+    }
+
+    return Reference {
+      mean, m_2 / (n - 1), std::sqrt (n) * m_3 / (m_2 * std::sqrt (m_2)), n * m_4 / (m_2 * m_2) - 3, minimum, maximum
+    };
+  }
+
+
+  /**
+   * @brief
+   * @param actual
+   * @param expected
+   * @param tolerance
+   * @return Whether  `actual'  is within relative  `tolerance'  of  `expected'.
+   */
+  bool
+  isNear (reference_type actual, reference_type expected, reference_type tolerance)
+  {
+    return ! (std::abs (actual - expected) > tolerance * std::abs (expected));
+  }
+
+
+  /**
+   * @brief
+   * @tparam TValue
+   * @param stats
+   * @param reference
+   * @param tolerance Relative tolerance of the moments;  minimum  &  maximum must be exact.
+   * @param name
+   * @return Whether all checks passed.
+   */
+  template <typename TValue>
+  bool
+  check (const Utils::RunningStats <TValue> & stats, const Reference & reference, reference_type tolerance, const char * name)
+  {
+    fmt::print (
+      std::cout, "  {0:<10s}mean {1:.3e}  variance {2:.3e}  skewness {3:.3e}  kurtosis {4:.3e}  (relative errors)\n",
+      name,
+      double (std::abs ((stats.mean () - reference.mean) / reference.mean)),
+      double (std::abs ((stats.variance () - reference.variance) / reference.variance)),
+      double (std::abs ((stats.skewness () - reference.skewness) / reference.skewness)),
+      double (std::abs ((stats.kurtosis () - reference.kurtosis) / reference.kurtosis))
+    );
+
+    if (
+      ! isNear (stats.mean (), reference.mean, tolerance) || ! isNear (stats.variance (), reference.variance, tolerance)
+      || ! isNear (stats.skewness (), reference.skewness, tolerance)
+      || ! isNear (stats.kurtosis (), reference.kurtosis, tolerance)
+      || (stats.minimum () != reference.minimum) || (stats.maximum () != reference.maximum)
+    )
+    {
+      fmt::print (std::cerr, "{0:s}:  statistics differ from the reference\n", name);
+      return false;
+    }
+
+    return true;
+  }
+
+
+  /**
+   * @brief Compares the scalar,  batch,  merged  &  parallel paths against the reference.
+   * @tparam TValue
+   * @param type_name
+   * @param scalar_tolerance Looser:  per-value updates divide by the running count,  so in  `float'  they lose
+   *   precision over a million values,  which the per-block updates of the other paths avoid.
+   * @param tolerance
+   * @return Whether all checks passed.
+   */
+  template <typename TValue>
+  bool
+  checkMoments (const char * type_name, reference_type scalar_tolerance, reference_type tolerance)
+  {
+    // Skewed values away from zero,  so the moments about the mean matter.
+    std::mt19937_64 engine (Seed);
+    std::gamma_distribution <TValue> distribution (TValue (2), TValue (1));
+    std::vector <TValue> values (Values_count);
+    for (TValue & value : values)
+    {
+      value = TValue (100) + distribution (engine);
+    }
+
+    const Reference reference (makeReference (values));
+    fmt::print (std::cout, "{0:s}:\n", type_name);
+
+    Utils::RunningStats <TValue> scalar;
+    for (const TValue value : values)
+    {
+      scalar.push (value);
+    }
+
+    Utils::RunningStats <TValue> batch;
+    batch.push (values.data (), values.size ());
+
+    Utils::RunningStats <TValue> merged;
+    Utils::RunningStats <TValue> second_half;
+    merged.push (values.data (), values.size () / 3);
+    second_half.push (values.data () + values.size () / 3, values.size () - values.size () / 3);
+    merged.merge (second_half);
+
+    const Utils::RunningStats <TValue> parallel (Utils::stats (values.cbegin (), values.cend ()));
+
+    bool is_ok (true);
+    is_ok = check (scalar, reference, scalar_tolerance, "scalar") && is_ok;
+    is_ok = check (batch, reference, tolerance, "batch") && is_ok;
+    is_ok = check (merged, reference, tolerance, "merged") && is_ok;
+    is_ok = check (parallel, reference, tolerance, "parallel") && is_ok;
+    if ((scalar.count () != Values_count) || (parallel.count () != Values_count))
+    {
+      fmt::print (std::cerr, "{0:s}:  wrong count\n", type_name);
+      is_ok = false;
+    }
+
+    return is_ok;
+  }
+
+
+  /**
+   * @brief NaN at the start of a block,  in the middle  &  at the end must not affect minimum  &  maximum.
+   * @tparam TValue
+   * @param type_name
+   * @return Whether all checks passed.
+   */
+  template <typename TValue>
+  bool
+  checkNan (const char * type_name)
+  {
+    constexpr std::size_t Block_size (Config::Utils::RunningStats::Block_size);
+
+    std::vector <TValue> values (2 * Block_size + 3);
+    for (std::size_t index (0); index < values.size (); ++ index)
+    {
+      values [index] = TValue (index % 17) - TValue (8);
+    }
+
+    values [0] = std::numeric_limits <TValue>::quiet_NaN ();
+    values [Block_size] = std::numeric_limits <TValue>::quiet_NaN ();
+    values [Block_size + 5] = std::numeric_limits <TValue>::quiet_NaN ();
+    values.back () = std::numeric_limits <TValue>::quiet_NaN ();
+
+    Utils::RunningStats <TValue> scalar;
+    for (const TValue value : values)
+    {
+      scalar.push (value);
+    }
+
+    Utils::RunningStats <TValue> batch;
+    batch.push (values.data (), values.size ());
+
+    for (const Utils::RunningStats <TValue> * const stats : { & scalar, & batch })
+    {
+      if ((stats->minimum () != TValue (- 8)) || (stats->maximum () != TValue (8)))
+      {
+        fmt::print (
+          std::cerr, "{0:s}:  NaN affected minimum or maximum  ({1:s} path)\n",
+          type_name, (stats == & scalar) ? "scalar" : "batch"
+        );
+        return false;
+      }
+    }
+
+    return true;
+  }
+}
+
+
+int
+main ()
+{
+  bool is_ok (true);
+  is_ok = checkMoments <float> ("float", 5e-2L, 1e-4L) && is_ok;
+  is_ok = checkMoments <double> ("double", 1e-12L, 1e-12L) && is_ok;
+  is_ok = checkNan <float> ("float") && is_ok;
+  is_ok = checkNan <double> ("double") && is_ok;
+
+  return is_ok ? 0 : 1;
+}
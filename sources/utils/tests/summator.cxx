@@ -0,0 +1,203 @@
+#include <cmath>  // std::{abs, ldexp}
+#include <cstddef>  // std::size_t
+#include <cstdint>  // std::{int64_t, uint64_t}
+
+#include <iostream>  // std::{cerr, cout}
+#include <limits>  // std::numeric_limits
+#include <random>  // std::{mt19937_64, uniform_int_distribution}
+#include <vector>  // std::vector
+
+#include <fmt/format.h>  // fmt::print
+#include <fmt/ostream.h>  // fmt::print[std::ostream]
+
+#include "../algorithms/sum.hxx"  // sum
+#include "../algorithms/summator.hxx"  // *SummationPolicy,  Summator
+#include "../config/summator.hxx"  // Config::Utils::Summator::Parallel_threshold
+
+
+namespace
+{
+  /**
+   * @brief Wide enough to hold the exact sums  &  the errors.
+   */
+  using reference_type = long double;
+
+
+  /**
+   * @brief Above  `Parallel_threshold',  so  `sum'  takes its parallel path.
+   */
+  constexpr std::size_t Terms_count (Config::Utils::Summator::Parallel_threshold + 12345);
+
+  /**
+   * @brief
+   */
+  constexpr std::uint64_t Seed (0x5eed);
+
+
+  /**
+   * @brief Terms whose exact sum is known.
+   * @tparam TTerm
+   */
+  template <typename TTerm>
+  struct Terms final
+  {
+    /**
+     * @brief
+     */
+    std::vector <TTerm> terms;
+
+    /**
+     * @brief
+     */
+    reference_type exact_sum;
+  };
+
+
+  /**
+   * @brief Small terms are  `k * 2^-(digits / 2 + 8)',  so all terms  &  the sum are exact.
+   * If  `is_cancelling',  then  |k| <= 1000  &  every 64th term is  +- 2^(digits / 2),  cancelling in pairs,
+   *   so small terms added to a big partial sum lose their low bits;  otherwise  1 <= k <= 1000.
+   * @tparam TTerm
+   * @param is_cancelling
+   * @return
+   */
+  template <typename TTerm>
+  Terms <TTerm>
+  makeTerms (bool is_cancelling)
+  {
+    constexpr int big_exponent (std::numeric_limits <TTerm>::digits / 2);
+    constexpr int small_exponent (- big_exponent - 8);
+
+    std::mt19937_64 engine (Seed);
+    std::uniform_int_distribution <std::int64_t> distribution (is_cancelling ? - 1000 : 1, 1000);
+
+    Terms <TTerm> result { { }, 0 };
+    result.terms.reserve (Terms_count + 1);
+
+    std::int64_t exact_units (0);
+    std::size_t big_terms_count (0);
+    for (std::size_t index (0); index < Terms_count; ++ index)
+    {
+      if (is_cancelling && (index % 64 == 0))
+      {
+        const double big_term (std::ldexp (1.0, big_exponent));
+        result.terms.push_back (TTerm ((big_terms_count % 2 == 0) ? big_term : - big_term));
+        ++ big_terms_count;
+        continue;
+      }
+
+      const std::int64_t units (distribution (engine));
+      exact_units += units;
+      result.terms.push_back (TTerm (std::ldexp (double (units), small_exponent)));
+    }
+
+    if (big_terms_count % 2 != 0)
+    {
+      result.terms.push_back (TTerm (- std::ldexp (1.0, big_exponent)));
+    }
+
+    result.exact_sum = std::ldexp (reference_type (exact_units), small_exponent);
+
+    return result;
+  }
+
+
+  /**
+   * @brief
+   * @tparam TTerm
+   * @tparam TSummationPolicy
+   * @param terms
+   * @return Absolute errors of  `Summator::add'  &  of  (parallel)  `sum'.
+   */
+  template <typename TTerm, typename TSummationPolicy>
+  std::vector <reference_type>
+  measureErrors (const Terms <TTerm> & terms)
+  {
+    using summator_type = Utils::Summator <TTerm, TSummationPolicy>;
+
+    summator_type summator;
+    summator.add (terms.terms.cbegin (), terms.terms.cend ());
+
+    const TTerm parallel_sum (
+      Utils::sum <typename std::vector <TTerm>::const_iterator, summator_type> (terms.terms.cbegin (), terms.terms.cend ())
+    );
+
+    return {
+      std::abs (reference_type (TTerm (summator)) - terms.exact_sum),
+      std::abs (reference_type (parallel_sum) - terms.exact_sum)
+    };
+  }
+
+
+  /**
+   * @brief Prints the errors of all policies  &  checks them:  Neumaier summation must be exact up to rounding
+   *   of the result;  without cancellation Kahan summation must be too  &  pairwise summation must be at least
+   *   as accurate as naive summation.
+   * Kahan summation isn't checked with cancellation:  it loses the correction when a term exceeds the sum.
+   * @tparam TTerm
+   * @param type_name
+   * @param is_cancelling
+   * @return Whether all checks passed.
+   */
+  template <typename TTerm>
+  bool
+  checkAccuracy (const char * type_name, bool is_cancelling)
+  {
+    const Terms <TTerm> terms (makeTerms <TTerm> (is_cancelling));
+
+    const std::vector <reference_type> naive (measureErrors <TTerm, Utils::NaiveSummationPolicy <TTerm>> (terms));
+    const std::vector <reference_type> kahan (measureErrors <TTerm, Utils::CompensatingSummationPolicy <TTerm>> (terms));
+    const std::vector <reference_type> neumaier (measureErrors <TTerm, Utils::NeumaierSummationPolicy <TTerm>> (terms));
+    const std::vector <reference_type> pairwise (measureErrors <TTerm, Utils::PairwiseSummationPolicy <TTerm>> (terms));
+
+    const char * const terms_name (is_cancelling ? "cancelling" : "same sign");
+    fmt::print (std::cout, "{0:s}, {1:s}:  exact sum  {2:.17g}\n", type_name, terms_name, double (terms.exact_sum));
+    fmt::print (std::cout, "  {0:<10s}{1:>16s}{2:>16s}\n", "policy", "add error", "sum error");
+    fmt::print (std::cout, "  {0:<10s}{1:>16.6g}{2:>16.6g}\n", "Naive", double (naive [0]), double (naive [1]));
+    fmt::print (std::cout, "  {0:<10s}{1:>16.6g}{2:>16.6g}\n", "Kahan", double (kahan [0]), double (kahan [1]));
+    fmt::print (std::cout, "  {0:<10s}{1:>16.6g}{2:>16.6g}\n", "Neumaier", double (neumaier [0]), double (neumaier [1]));
+    fmt::print (std::cout, "  {0:<10s}{1:>16.6g}{2:>16.6g}\n", "Pairwise", double (pairwise [0]), double (pairwise [1]));
+
+    const long double rounding_error (
+      std::abs (terms.exact_sum) * reference_type (std::numeric_limits <TTerm>::epsilon ())
+    );
+
+    bool is_ok (true);
+    for (std::size_t index (0); index < 2; ++ index)
+    {
+      if (! (neumaier [index] <= rounding_error))
+      {
+        fmt::print (std::cerr, "{0:s}, {1:s}:  Neumaier summation isn't exact up to rounding\n", type_name, terms_name);
+        is_ok = false;
+      }
+
+      if (! is_cancelling && ! (kahan [index] <= rounding_error))
+      {
+        fmt::print (std::cerr, "{0:s}, {1:s}:  Kahan summation isn't exact up to rounding\n", type_name, terms_name);
+        is_ok = false;
+      }
+
+      if (! is_cancelling && ! (pairwise [index] <= naive [index]))
+      {
+        fmt::print (std::cerr, "{0:s}, {1:s}:  pairwise summation is less accurate than naive\n", type_name, terms_name);
+        is_ok = false;
+      }
+    }
+
+    return is_ok;
+  }
+}
+
+
+int
+main ()
+{
+  bool is_ok (true);
+  for (const bool is_cancelling : { false, true })
+  {
+    is_ok = checkAccuracy <float> ("float", is_cancelling) && is_ok;
+    is_ok = checkAccuracy <double> ("double", is_cancelling) && is_ok;
+  }
+
+  return is_ok ? 0 : 1;
+}